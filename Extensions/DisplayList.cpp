@@ -0,0 +1,329 @@
+/***************************************************************************************
+// Display list, see DisplayList.h
+***************************************************************************************/
+
+/***************************************************************************************
+** Function name:           startDisplayList
+** Description:             Start recording drawing commands
+*************************************************************************************x*/
+void TFT_eSPI::startDisplayList(uint32_t bytes)
+{
+  endDisplayList();
+
+  uint32_t size = bytes / sizeof(dlRect);
+  if (size > 0xFFFF) size = 0xFFFF;
+  if (size < 1) return;
+
+  _dlList = (dlRect*)malloc(size * sizeof(dlRect));
+  if (_dlList) _dlSize = size;
+}
+
+
+/***************************************************************************************
+** Function name:           endDisplayList
+** Description:             Draw the recorded commands and stop recording
+*************************************************************************************x*/
+void TFT_eSPI::endDisplayList(void)
+{
+  flushDisplayList();
+
+  free(_dlList);
+  _dlList = NULL;
+  _dlSize = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           flushDisplayList
+** Description:             Draw the recorded commands in one transaction
+*************************************************************************************x*/
+void TFT_eSPI::flushDisplayList(void)
+{
+  if (!_dlCount) return;
+
+  begin_tft_write();
+
+  replayDisplayList();
+
+  end_tft_write();
+}
+
+
+/***************************************************************************************
+** Function name:           setDisplayListBand
+** Description:             Draw the recorded commands through a Sprite band, or NULL
+*************************************************************************************x*/
+void TFT_eSPI::setDisplayListBand(TFT_eSprite* band)
+{
+  flushDisplayList();
+
+  _dlBand = band;
+}
+
+
+/***************************************************************************************
+** Function name:           recordRect
+** Description:             Add a clipped fill to the display list
+*************************************************************************************x*/
+void TFT_eSPI::recordRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  if (_dlCount == _dlSize)
+  {
+    // A band draws the scene without flicker only if it is all in the list, so grow the
+    // list, and if it cannot grow draw what has been recorded so far
+    uint32_t size = min((uint32_t)_dlSize * 2, (uint32_t)0xFFFF);
+    dlRect* list = NULL;
+    if (_dlBand && (_dlBand->width() > 0) && (size > _dlSize)) list = (dlRect*)realloc(_dlList, size * sizeof(dlRect));
+
+    if (list)
+    {
+      _dlList = list;
+      _dlSize = size;
+    }
+    else
+    {
+      if (_dlBand) dlStats.overflows++;
+      flushDisplayList();
+    }
+  }
+
+  dlRect &r = _dlList[_dlCount++];
+  r.x = x; r.y = y; r.w = w; r.h = h;
+  r.color = color;
+
+  dlStats.recorded++;
+}
+
+
+/***************************************************************************************
+** Function name:           coalesceDisplayList
+** Description:             Merge and remove recorded commands without changing the result
+*************************************************************************************x*/
+void TFT_eSPI::coalesceDisplayList(void)
+{
+  dlRect* list = _dlList;
+
+  auto overlaps = [](const dlRect &a, const dlRect &b) {
+    return (a.x < b.x + b.w) && (b.x < a.x + a.w) && (a.y < b.y + b.h) && (b.y < a.y + a.h);
+  };
+
+  // Merge a command into an earlier one of the same colour when together they make a
+  // rectangle, e.g. the rows of a filled shape. The merged fill is drawn in place of the
+  // later one, so no command in between may touch either.
+  for (uint16_t i = 1; i < _dlCount; i++)
+  {
+    dlRect &b = list[i];
+    uint16_t first = (i > DISPLAY_LIST_MERGE) ? i - DISPLAY_LIST_MERGE : 0;
+
+    for (int32_t j = i - 1; j >= first; j--)
+    {
+      dlRect &a = list[j];
+      if (!a.w || (a.color != b.color)) continue;
+
+      int32_t x0 = min(a.x, b.x), x1 = max(a.x + a.w, b.x + b.w);
+      int32_t y0 = min(a.y, b.y), y1 = max(a.y + a.h, b.y + b.h);
+
+      bool column = (a.x == b.x) && (a.w == b.w) && (a.y <= b.y + b.h) && (b.y <= a.y + a.h);
+      bool row    = (a.y == b.y) && (a.h == b.h) && (a.x <= b.x + b.w) && (b.x <= a.x + a.w);
+      bool inside = ((x1 - x0 == a.w) && (y1 - y0 == a.h)) || ((x1 - x0 == b.w) && (y1 - y0 == b.h));
+      if (!column && !row && !inside) continue;
+
+      dlRect merged = { (int16_t)x0, (int16_t)y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0), b.color };
+
+      uint16_t k = j + 1;
+      while ((k < i) && (!list[k].w || !overlaps(list[k], merged))) k++;
+      if (k < i) continue;
+
+      b = merged;
+      a.w = 0;
+      dlStats.merged++;
+    }
+  }
+
+  // A later fill replaces the pixels it covers whatever is drawn in between, so remove
+  // commands that are drawn over completely and cut back those drawn over along one side.
+  // Only the next few commands are searched so a long list does not take too long.
+  for (uint16_t i = 0; i < _dlCount; i++)
+  {
+    dlRect &a = list[i];
+    uint16_t end = (_dlCount - i > DISPLAY_LIST_COVER) ? i + 1 + DISPLAY_LIST_COVER : _dlCount;
+
+    for (uint16_t k = i + 1; a.w && (k < end); k++)
+    {
+      dlRect &b = list[k];
+      if (!b.w || !overlaps(a, b)) continue;
+
+      int32_t ax1 = a.x + a.w, ay1 = a.y + a.h;
+      int32_t bx1 = b.x + b.w, by1 = b.y + b.h;
+
+      if ((b.y <= a.y) && (by1 >= ay1))      // b spans the rows of a
+      {
+        if ((b.x <= a.x) && (bx1 >= ax1)) a.w = 0;
+        else if (b.x <= a.x) { a.w = ax1 - bx1; a.x = bx1; }
+        else if (bx1 >= ax1) a.w = b.x - a.x;
+      }
+      else if ((b.x <= a.x) && (bx1 >= ax1)) // b spans the columns of a
+      {
+        if (b.y <= a.y) { a.h = ay1 - by1; a.y = by1; }
+        else if (by1 >= ay1) a.h = b.y - a.y;
+      }
+
+      if (!a.w) dlStats.dropped++;
+    }
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           replayDisplayList
+** Description:             Send the recorded commands, a write must be in progress
+*************************************************************************************x*/
+void TFT_eSPI::replayDisplayList(void)
+{
+  coalesceDisplayList();
+
+  // Detach the list so the commands are drawn rather than recorded again
+  dlRect*  list  = _dlList;
+  uint16_t count = _dlCount;
+  _dlList  = NULL;
+  _dlCount = 0;
+
+  // Keep the caller's transaction open
+  bool wasInTransaction = inTransaction;
+  inTransaction = true;
+
+  if (_dlBand && (_dlBand->width() > 0)) drawDisplayListBands(list, count);
+  else for (uint16_t i = 0; i < count; i++)
+  {
+    dlRect &r = list[i];
+    if (!r.w) continue;
+
+    if ((r.w == 1) && (r.h == 1)) drawPixel(r.x, r.y, r.color);
+    else fillRect(r.x, r.y, r.w, r.h, r.color);
+    dlStats.drawn++;
+  }
+
+  inTransaction = wasInTransaction;
+
+  _dlList = list;
+  dlStats.flushes++;
+}
+
+
+/***************************************************************************************
+** Function name:           drawDisplayListBands
+** Description:             Compose the commands in the Sprite band and push each band
+*************************************************************************************x*/
+void TFT_eSPI::drawDisplayListBands(dlRect* list, uint16_t count)
+{
+  // Area covered by the commands
+  int32_t x0 = _width, y0 = _height, x1 = 0, y1 = 0;
+
+  for (uint16_t i = 0; i < count; i++)
+  {
+    dlRect &r = list[i];
+    if (!r.w) continue;
+
+    x0 = min(x0, (int32_t)r.x); x1 = max(x1, (int32_t)(r.x + r.w));
+    y0 = min(y0, (int32_t)r.y); y1 = max(y1, (int32_t)(r.y + r.h));
+    dlStats.drawn++;
+  }
+
+  if ((x1 <= x0) || (y1 <= y0)) return;
+
+  TFT_eSprite* band = _dlBand;
+  int32_t bw = band->width(), bh = band->height();
+
+  // Line of colours in the order they are sent, then a bit for each band pixel a command
+  // draws. Only those pixels are pushed so whatever else is on the screen is kept.
+  int32_t stride = (bw + 7) >> 3;
+  uint16_t* line = (uint16_t*)malloc((bw << 1) + stride * bh);
+  if (!line) return;
+  uint8_t* cover = (uint8_t*)(line + bw);
+
+  auto covered = [](const uint8_t* row, int32_t x) { return row[x >> 3] & (0x80 >> (x & 7)); };
+
+  bool oldSwapBytes = _swapBytes;
+  _swapBytes = false;
+
+  // The covered pixels are pushed, so the areas drawn in the band need not be recorded
+  band->setDirtyTracking(false);
+
+  for (int32_t by = y0; by < y1; by += bh)
+  {
+    int32_t th = min(bh, y1 - by);
+
+    for (int32_t bx = x0; bx < x1; bx += bw)
+    {
+      int32_t tw = min(bw, x1 - bx);
+
+      memset(cover, 0, stride * th);
+
+      // Draw the part of each command in the band, in the order they were recorded
+      for (uint16_t i = 0; i < count; i++)
+      {
+        dlRect &r = list[i];
+        if (!r.w) continue;
+
+        int32_t cx0 = max(bx, (int32_t)r.x), cx1 = min(bx + tw, (int32_t)(r.x + r.w));
+        int32_t cy0 = max(by, (int32_t)r.y), cy1 = min(by + th, (int32_t)(r.y + r.h));
+        if ((cx0 >= cx1) || (cy0 >= cy1)) continue;
+
+        band->fillRect(cx0 - bx, cy0 - by, cx1 - cx0, cy1 - cy0, r.color);
+
+        for (int32_t yp = cy0 - by; yp < cy1 - by; yp++)
+        {
+          uint8_t* row = cover + yp * stride;
+          int32_t xp = cx0 - bx, xe = cx1 - bx;
+          while ((xp < xe) && (xp & 7)) { row[xp >> 3] |= 0x80 >> (xp & 7); xp++; }
+          while (xp + 8 <= xe) { row[xp >> 3] = 0xFF; xp += 8; }
+          while (xp < xe) { row[xp >> 3] |= 0x80 >> (xp & 7); xp++; }
+        }
+      }
+
+      // Push the covered runs of each line in the caller's transaction. Lines covered from
+      // end to end share one window down to the bottom of the band.
+      bool open = false;
+
+      for (int32_t yp = 0; yp < th; yp++)
+      {
+        const uint8_t* row = cover + yp * stride;
+        bool composed = false;
+        int32_t xp = 0;
+
+        while (xp < tw)
+        {
+          while ((xp < tw) && !covered(row, xp)) xp += ((xp & 7) || row[xp >> 3]) ? 1 : 8;
+          if (xp >= tw) break;
+
+          int32_t xs = xp;
+          while ((xp < tw) && covered(row, xp)) xp += ((xp & 7) || (row[xp >> 3] != 0xFF)) ? 1 : 8;
+          if (xp > tw) xp = tw;
+
+          if (!composed) { band->composeLine(line, 0, tw, yp, LAYER_OPAQUE, NULL); composed = true; }
+
+          if ((xs == 0) && (xp == tw))
+          {
+            if (!open) setWindow(bx, by + yp, bx + tw - 1, by + th - 1);
+            open = true;
+          }
+          else
+          {
+            setWindow(bx + xs, by + yp, bx + xp - 1, by + yp);
+            open = false;
+          }
+
+          pushPixels(line + xs, xp - xs);
+        }
+
+        if (!composed) open = false;
+      }
+
+      dlStats.bands++;
+    }
+  }
+
+  _swapBytes = oldSwapBytes;
+
+  free(line);
+}
@@ -0,0 +1,70 @@
+/***************************************************************************************
+// Display list, part of the TFT_eSPI class. drawPixel(), drawFastHLine(), drawFastVLine()
+// and fillRect(), and so all the shapes drawn with them, are recorded as rectangle fills
+// instead of being sent to the TFT. When the list is flushed fills of the same colour that
+// touch are merged, fills drawn over by later ones are removed or cut back, and the rest
+// are sent in one transaction, or composed a band at a time in a Sprite and pushed.
+***************************************************************************************/
+
+// Default RAM for the recorded commands, 10 bytes each
+#ifndef DISPLAY_LIST_BYTES
+  #define DISPLAY_LIST_BYTES 2048
+#endif
+
+// Number of earlier commands searched for one of the same colour to merge with
+#define DISPLAY_LIST_MERGE 8
+
+// Number of later commands searched for fills that draw over a command
+#ifndef DISPLAY_LIST_COVER
+  #define DISPLAY_LIST_COVER 32
+#endif
+
+ public:
+           // Start recording, the list holds up to bytes / 10 commands and is flushed when full.
+           // Anything else drawn or read while recording, and setRotation(), flushes it first
+           // so the screen is drawn in the same order.
+  void     startDisplayList(uint32_t bytes = DISPLAY_LIST_BYTES);
+  void     flushDisplayList(void);       // Draw the recorded commands, recording continues
+  void     endDisplayList(void);         // Flush and stop recording, the list is freed
+  bool     displayListActive(void) {return _dlList != NULL;};
+
+           // Draw the list through a 16 or 8 bit Sprite band made for this TFT, e.g. 480 x 32, so
+           // the screen is composed in RAM without flicker. The commands are drawn in the band a
+           // band at a time and only the pixels they cover are pushed, so anything drawn that is
+           // not recorded is kept. The list grows when full so the whole scene is drawn at once,
+           // if it cannot it is drawn part way and dlStats.overflows counts it. The commands are
+           // cleared once drawn, so record the scene for each frame. NULL draws them directly.
+  void     setDisplayListBand(TFT_eSprite* band);
+
+  // Display list statistics
+  typedef struct
+  {
+    uint32_t recorded;                   // Drawing calls recorded
+    uint32_t merged;                     // Commands merged into another of the same colour
+    uint32_t dropped;                    // Commands removed as later commands draw over them
+    uint32_t drawn;                      // Fills sent to the TFT
+    uint32_t flushes;                    // Times the list was drawn
+    uint32_t bands;                      // Sprite bands pushed
+    uint32_t overflows;                  // Times a band list was drawn part way as it could not grow
+  } displayListStats;
+
+displayListStats dlStats = { 0, 0, 0, 0, 0, 0, 0 };
+
+ private:
+  // A recorded fill, clipped to the screen
+  typedef struct
+  {
+    int16_t  x, y;
+    int16_t  w, h;                       // Size, w is 0 once the command has been removed
+    uint16_t color;
+  } dlRect;
+
+  dlRect*  _dlList = NULL;               // Recorded commands, NULL when not recording
+  uint16_t _dlSize = 0;                  // Commands the list can hold
+  uint16_t _dlCount = 0;                 // Commands recorded
+  TFT_eSprite* _dlBand = NULL;           // Sprite band the list is drawn through, or NULL
+
+  void     recordRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void     coalesceDisplayList(void);
+  void     replayDisplayList(void);
+  void     drawDisplayListBands(dlRect* list, uint16_t count);
@@ -0,0 +1,182 @@
+/***************************************************************************************
+// Font data sources for the anti-aliased (smooth) fonts, see FontSource.h
+***************************************************************************************/
+
+#if defined (__unix__) || defined (__APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#ifdef FONT_FS_AVAILABLE
+/***************************************************************************************
+** Function name:           open
+** Description:             Open the font file
+*************************************************************************************x*/
+bool TFT_eSPI_FontSourceFS::open(void)
+{
+  if (_file) return true;
+
+  // Avoid a crash on the ESP32 if the file does not exist
+  if (_fs.exists(_path) == false) return false;
+
+  _file = _fs.open(_path, "r");
+  return (bool)_file;
+}
+
+
+/***************************************************************************************
+** Function name:           close
+** Description:             Close the font file
+*************************************************************************************x*/
+void TFT_eSPI_FontSourceFS::close(void)
+{
+  _file.close();
+}
+
+
+/***************************************************************************************
+** Function name:           seek
+** Description:             Set the font file read position
+*************************************************************************************x*/
+bool TFT_eSPI_FontSourceFS::seek(uint32_t pos)
+{
+  return _file.seek(pos, fs::SeekSet); // This is slow for a significant position shift!
+}
+
+
+/***************************************************************************************
+** Function name:           read
+** Description:             Read bytes from the font file
+*************************************************************************************x*/
+size_t TFT_eSPI_FontSourceFS::read(uint8_t *buffer, size_t size)
+{
+  return _file.read(buffer, size);
+}
+#endif
+
+
+/***************************************************************************************
+** Function name:           read
+** Description:             Copy bytes from the font array
+*************************************************************************************x*/
+size_t TFT_eSPI_FontSourceArray::read(uint8_t *buffer, size_t size)
+{
+  memcpy_P(buffer, _array + _pos, size);
+  _pos += size;
+  return size;
+}
+
+
+/***************************************************************************************
+** Function name:           pointer
+** Description:             Get the address of data in the font array
+*************************************************************************************x*/
+const uint8_t* TFT_eSPI_FontSourceArray::pointer(uint32_t pos)
+{
+#if defined (ESP8266) // The ESP8266 can only read PROGMEM 32 bits at a time
+  (void)pos;
+  return NULL;
+#else
+  return _array + pos;
+#endif
+}
+
+
+#if defined (__unix__) || defined (__APPLE__)
+/***************************************************************************************
+** Function name:           open
+** Description:             Open the font file and map it into memory if possible
+*************************************************************************************x*/
+bool TFT_eSPI_FontSourcePOSIX::open(void)
+{
+  if (_fd >= 0) return true;
+
+  _fd = ::open(_path.c_str(), O_RDONLY);
+  if (_fd < 0) return false;
+
+  struct stat st;
+  if (fstat(_fd, &st) != 0) { close(); return false; }
+  _size = st.st_size;
+  _pos  = 0;
+
+  if (_map && _size)
+  {
+    void* mapped = mmap(NULL, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+    if (mapped != MAP_FAILED) _mapped = (uint8_t*)mapped; // Otherwise fall back to reads
+  }
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           close
+** Description:             Unmap and close the font file
+*************************************************************************************x*/
+void TFT_eSPI_FontSourcePOSIX::close(void)
+{
+  if (_mapped)
+  {
+    munmap(_mapped, _size);
+    _mapped = NULL;
+  }
+
+  if (_fd >= 0)
+  {
+    ::close(_fd);
+    _fd = -1;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           seek
+** Description:             Set the font file read position
+*************************************************************************************x*/
+bool TFT_eSPI_FontSourcePOSIX::seek(uint32_t pos)
+{
+  if (pos > _size) return false;
+  _pos = pos;
+  if (_mapped) return true;
+  return lseek(_fd, pos, SEEK_SET) == (off_t)pos;
+}
+
+
+/***************************************************************************************
+** Function name:           read
+** Description:             Read bytes from the font file
+*************************************************************************************x*/
+size_t TFT_eSPI_FontSourcePOSIX::read(uint8_t *buffer, size_t size)
+{
+  if (_fd < 0) return 0;
+  if (size > _size - _pos) size = _size - _pos;
+
+  if (_mapped) memcpy(buffer, _mapped + _pos, size);
+  else
+  {
+    size_t done = 0;
+    while (done < size)
+    {
+      ssize_t n = ::read(_fd, buffer + done, size - done);
+      if (n <= 0) break;
+      done += n;
+    }
+    size = done;
+  }
+
+  _pos += size;
+  return size;
+}
+
+
+/***************************************************************************************
+** Function name:           pointer
+** Description:             Get the address of data in the mapped font file
+*************************************************************************************x*/
+const uint8_t* TFT_eSPI_FontSourcePOSIX::pointer(uint32_t pos)
+{
+  if (!_mapped || (pos >= _size)) return NULL;
+  return _mapped + pos;
+}
+#endif
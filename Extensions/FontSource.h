@@ -0,0 +1,97 @@
+/***************************************************************************************
+// Font data sources for the anti-aliased (smooth) fonts. TFT_eSPI_SmoothFont reads the
+// font header, metrics and glyph bitmaps through a source, so the same font can be held
+// in a file system, a memory or PROGMEM array, or a file on a host PC.
+***************************************************************************************/
+#pragma once
+
+/***************************************************************************************
+**                         Font source interface
+***************************************************************************************/
+class TFT_eSPI_FontSource {
+
+ public:
+  virtual ~TFT_eSPI_FontSource() {};
+
+           // Prepare to read the font, returns false if the font data cannot be found
+  virtual bool   open(void) = 0;
+  virtual void   close(void) {};
+
+           // Set the read position, an offset from the start of the font data
+  virtual bool   seek(uint32_t pos) = 0;
+           // Read size bytes from the read position, returns the number of bytes read
+  virtual size_t read(uint8_t *buffer, size_t size) = 0;
+
+           // Address of the font data at offset pos, or NULL if the data cannot be read in
+           // place. Glyphs in an addressable font are drawn without copying the bitmap.
+  virtual const uint8_t* pointer(uint32_t pos) {(void)pos; return NULL;};
+};
+
+
+#ifdef FONT_FS_AVAILABLE
+/***************************************************************************************
+**                         Font file in a file system (SPIFFS, LittleFS, SD etc)
+***************************************************************************************/
+class TFT_eSPI_FontSourceFS : public TFT_eSPI_FontSource {
+
+ public:
+  TFT_eSPI_FontSourceFS(fs::FS &fs, const String &path) : _fs(fs), _path(path) {};
+
+  bool   open(void);
+  void   close(void);
+  bool   seek(uint32_t pos);
+  size_t read(uint8_t *buffer, size_t size);
+
+ private:
+  fs::FS  &_fs;
+  String   _path;
+  fs::File _file;
+};
+#endif
+
+
+/***************************************************************************************
+**                         Font in a memory or PROGMEM array
+***************************************************************************************/
+class TFT_eSPI_FontSourceArray : public TFT_eSPI_FontSource {
+
+ public:
+  TFT_eSPI_FontSourceArray(const uint8_t *array) : _array(array) {};
+
+  bool   open(void) {return _array != NULL;};
+  bool   seek(uint32_t pos) {_pos = pos; return true;};
+  size_t read(uint8_t *buffer, size_t size);
+  const uint8_t* pointer(uint32_t pos);
+
+ private:
+  const uint8_t* _array;
+  uint32_t       _pos = 0;
+};
+
+
+#if defined (__unix__) || defined (__APPLE__)
+/***************************************************************************************
+**                         Font file on a host with POSIX file access
+***************************************************************************************/
+// Used when the library is built on a PC for testing or simulation. The file is memory
+// mapped when possible so it can be drawn in place, otherwise it is read like a file.
+class TFT_eSPI_FontSourcePOSIX : public TFT_eSPI_FontSource {
+
+ public:
+  TFT_eSPI_FontSourcePOSIX(const char *path, bool map = true) : _path(path), _map(map) {};
+
+  bool   open(void);
+  void   close(void);
+  bool   seek(uint32_t pos);
+  size_t read(uint8_t *buffer, size_t size);
+  const uint8_t* pointer(uint32_t pos);
+
+ private:
+  String   _path;
+  bool     _map;
+  int      _fd = -1;
+  uint8_t* _mapped = NULL;  // Whole file mapping, NULL if the file is read
+  size_t   _size = 0;
+  uint32_t _pos = 0;
+};
+#endif
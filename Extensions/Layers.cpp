@@ -0,0 +1,57 @@
+/***************************************************************************************
+// Sprite layers, see Layers.h
+***************************************************************************************/
+
+/***************************************************************************************
+** Function name:           pushLayers
+** Description:             Merge Sprite layers a line at a time and push each line once
+*************************************************************************************x*/
+void TFT_eSPI::pushLayers(int32_t x, int32_t y, int32_t w, int32_t h,
+                          const spriteLayer* layers, uint8_t count, uint16_t bg)
+{
+  // Clipping
+  if ((x >= _width) || (y >= _height)) return;
+
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+
+  if ((x + w) > _width)  w = _width  - x;
+  if ((y + h) > _height) h = _height - y;
+
+  if ((w < 1) || (h < 1)) return;
+
+  // Line of colours in the order they are sent
+  uint16_t* line = (uint16_t*)malloc(w << 1);
+  if (!line) return;
+
+  bg = (bg >> 8) | (bg << 8);
+
+  bool oldSwapBytes = _swapBytes;
+  _swapBytes = false;
+
+  begin_tft_write();
+  bool wasInTransaction = inTransaction;
+  inTransaction = true;
+
+  setWindow(x, y, x + w - 1, y + h - 1);
+
+  for (int32_t yp = y; yp < y + h; yp++)
+  {
+    for (int32_t i = 0; i < w; i++) line[i] = bg;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+      const spriteLayer &l = layers[i];
+      if (l.sprite) l.sprite->composeLine(line, x - l.x, w, yp - l.y, l.transp, l.palette);
+    }
+
+    pushPixels(line, w);
+  }
+
+  inTransaction = wasInTransaction;
+  end_tft_write();
+
+  _swapBytes = oldSwapBytes;
+
+  free(line);
+}
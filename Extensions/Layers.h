@@ -0,0 +1,25 @@
+/***************************************************************************************
+// Sprite layers, part of the TFT_eSPI class. Sprites at any position, each with its own
+// transparent colour, are merged one screen line at a time in a line buffer and each line
+// is pushed once, so overlapping Sprites do not flicker and no screen buffer is needed.
+***************************************************************************************/
+
+// Transparent colour of a layer with no transparent pixels
+#define LAYER_OPAQUE 0x10000
+
+ public:
+  // A Sprite layer for pushLayers()
+  typedef struct
+  {
+    TFT_eSprite*    sprite;
+    int16_t         x, y;                // Position of the Sprite top left on the screen
+    uint32_t        transp;              // Transparent colour as for pushSprite(), 4 bpp palette
+                                         // index, 1 bpp bit value, or LAYER_OPAQUE
+    const uint16_t* palette;             // 16 colours for 4 bpp, bg and fg for 1 bpp, NULL for
+                                         // the Sprite colour map and the bitmap colours
+  } spriteLayer;
+
+           // Draw the area x, y, w, h with the layers in order, the first at the bottom, over a
+           // bg background. Each Sprite may be 1, 4, 8 or 16 bpp, RAM for one line is used.
+  void     pushLayers(int32_t x, int32_t y, int32_t w, int32_t h,
+                      const spriteLayer* layers, uint8_t count, uint16_t bg = TFT_BLACK);
@@ -1,14 +1,21 @@
 
 #include "SmoothFont.h"
-#include <FS.h>
+#ifdef FONT_FS_AVAILABLE
+  #include <FS.h>
+#endif
+#include <algorithm>
 
 
 
  std::map<String, TFT_eSPI_SmoothFont *  >  TFT_eSPI_SmoothFont::Fonts;
 
+size_t   TFT_eSPI_SmoothFont::_residentBudget = SMOOTH_FONT_BUDGET;
+uint32_t TFT_eSPI_SmoothFont::_useClock = 0;
+TFT_eSPI_SmoothFont::residencyStats TFT_eSPI_SmoothFont::residency = { 0, 0, 0, 0 };
+
 /***************************************************************************************
 ** Function name:           loadFont
-** Description:             loads parameters from a font vlw file
+** Description:             loads parameters from a vlw or indexed (vli) font
 *************************************************************************************x*/
 void TFT_eSPI_SmoothFont::loadFont()
 {
@@ -71,58 +78,118 @@ void TFT_eSPI_SmoothFont::loadFont()
 
   */
 
-  _lastLoadTime = millis();//set access time
+  _lastUse = ++_useClock;
 
   if (fontLoaded) return;
 
+    bool reload = _metadataLoaded;
+    unsigned long startTime = micros();
 
-    String oldestFont;
-    unsigned long acessTime = 0-1;
-    uint8_t loadedFonts = 0;
-    for (auto & f : Fonts) {
-        if (f.second->loaded()) {
-          loadedFonts++;
-          if (f.second->lastLoadTime() < acessTime) {
-            acessTime = f.second->lastLoadTime();
-            oldestFont = f.first;
-          }
-        }
-       // Serial.printf("Font: %s, loaded: %d, size: %zu, access time: %lu \n", f.first.c_str(), (f.second->loaded()) ? 1 : 0, f.second->metricsSize(), _lastLoadTime);
-    }
-    if (loadedFonts > 3) {
-      Fonts.at(oldestFont)->unloadFont();
-    }
+    // Make room for the metrics if the size is known from an earlier load
+    makeRoom(metricsSize(), this);
 
-    // Avoid a crash on the ESP32 if the file does not exist
-    if (fontFS.exists(fontPath) == false) {
-      Serial.println("Font file " + fontPath + " not found!");
+    if (!source || !source->open()) {
+      if (fontPath.length()) Serial.println("Font file " + fontPath + " not found!");
+      else Serial.println("Font source could not be opened!");
       return;
     }
 
-    fontFile = fontFS.open( fontPath , "r");
+    source->seek(0);
+  
+    //Load metadata once, a compiled font has no header
+    if (!_metadataLoaded && !_compiled) {
+      // Read enough for either header, the indexed font header is the larger
+      uint8_t header[VLI_HEADER_SIZE];
+      size_t  length = source->read(header, VLI_HEADER_SIZE);
+
+      if (length == VLI_HEADER_SIZE && readIndexHeader(header)) {
+        // Indexed font, metrics are in the header
+      }
+      else if (length >= 24) {
+        gFont.gCount   = (uint16_t)readInt32(header);      // glyph count in file
+                                                            // vlw encoder version - discard
+        gFont.height   = (uint16_t)readInt32(header + 8);  // Font size in points, not pixels
+                                                            // discard
+        gFont.ascent   = (uint16_t)readInt32(header + 16); // top of "d"
+        gFont.descent  = (uint16_t)readInt32(header + 20); // bottom of "p"
+
+        // These next gFont values might be updated when the Metrics are fetched
+        gFont.maxAscent  = gFont.ascent;   // Determined from metrics
+        gFont.maxDescent = gFont.descent;  // Determined from metrics
+        gFont.yAdvance   = gFont.ascent + gFont.descent;
+        gFont.spaceWidth = gFont.yAdvance / 4;  // Guess at space width
+      }
+      else {
+        source->close();
+        return;
+      }
+    }
+  // Fetch the metrics for each glyph
+  if (_compiled) loadCompiled();
+  else if (_indexed) loadIndex();
+  else loadMetrics();
+
+  if (!fontLoaded) return;
 
-    if(!fontFile) return;
+  if (reload) {
+    residency.reloads++;
+    residency.reloadMicros += micros() - startTime;
+  }
+  else residency.loads++;
 
-    fontFile.seek(0, fs::SeekSet);
-  
-    //Load metadata once
-    if (!_metadataLoaded) {
-      gFont.gCount   = (uint16_t)readInt32(); // glyph count in file
-                                readInt32(); // vlw encoder version - discard
-      gFont.height = (uint16_t)readInt32(); // Font size in points, not pixels
-                                readInt32(); // discard
-      gFont.ascent   = (uint16_t)readInt32(); // top of "d"
-      gFont.descent  = (uint16_t)readInt32(); // bottom of "p"
-
-      // These next gFont values might be updated when the Metrics are fetched
-      gFont.maxAscent  = gFont.ascent;   // Determined from metrics
-      gFont.maxDescent = gFont.descent;  // Determined from metrics
-      gFont.yAdvance   = gFont.ascent + gFont.descent;
-      gFont.spaceWidth = gFont.yAdvance / 4;  // Guess at space width
+  // The size of a first load is only known now
+  makeRoom(0, this);
+}
 
+
+/***************************************************************************************
+** Function name:           makeRoom
+** Description:             Unload least recently used fonts to stay within the budget
+*************************************************************************************x*/
+void TFT_eSPI_SmoothFont::makeRoom(size_t bytes, TFT_eSPI_SmoothFont *keep)
+{
+  while (residentBytes() + bytes > _residentBudget)
+  {
+    TFT_eSPI_SmoothFont* oldest = NULL;
+
+    for (auto & f : Fonts) {
+      TFT_eSPI_SmoothFont* font = f.second;
+      if (font->loaded() && !font->pinned() && (font != keep)) {
+        if (!oldest || (font->lastUse() < oldest->lastUse())) oldest = font;
+      }
     }
-  // Fetch the metrics for each glyph
-  loadMetrics();
+
+    if (!oldest) return; // Nothing more can be unloaded
+
+    oldest->unloadFont();
+    residency.evictions++;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           setResidentBudget
+** Description:             Set the RAM budget for loaded font files
+*************************************************************************************x*/
+void TFT_eSPI_SmoothFont::setResidentBudget(size_t bytes)
+{
+  _residentBudget = bytes;
+  makeRoom(0, NULL);
+}
+
+
+/***************************************************************************************
+** Function name:           residentBytes
+** Description:             Get the RAM held by the loaded font files
+*************************************************************************************x*/
+size_t TFT_eSPI_SmoothFont::residentBytes(void)
+{
+  size_t bytes = 0;
+
+  for (auto & f : Fonts) {
+    if (f.second->loaded()) bytes += f.second->metricsSize() + f.second->cacheStats.bytes;
+  }
+  return bytes;
 }
 
 
@@ -136,13 +203,13 @@ void TFT_eSPI_SmoothFont::loadMetrics(void)
   uint32_t headerPtr = 24;
   uint32_t bitmapPtr = headerPtr + gFont.gCount * 28;
 
-  gUnicode  = (uint16_t*)malloc( gFont.gCount * 2); // Unicode 16 bit Basic Multilingual Plane (0-FFFF)
-  gHeight   =  (uint8_t*)malloc( gFont.gCount );    // Height of glyph
-  gWidth    =  (uint8_t*)malloc( gFont.gCount );    // Width of glyph
-  gxAdvance =  (uint8_t*)malloc( gFont.gCount );    // xAdvance - to move x cursor
-  gdY       =  (int16_t*)malloc( gFont.gCount * 2); // offset from bitmap top edge from lowest point in any character
-  gdX       =   (int8_t*)malloc( gFont.gCount );    // offset for bitmap left edge relative to cursor X
-  gBitmap   = (uint32_t*)malloc( gFont.gCount * 4); // seek pointer to glyph bitmap in the file
+  unsigned long startTime = micros();
+
+  // All the glyph metrics go in one block, widest types first to keep each array aligned
+  gBitmap = (uint32_t*)malloc( gFont.gCount * 12);
+  if (!gBitmap) { source->close(); return; }
+
+  mapMetrics();
 
 
 #ifdef SHOW_ASCENT_DESCENT
@@ -150,19 +217,42 @@ void TFT_eSPI_SmoothFont::loadMetrics(void)
   Serial.print("descent = "); Serial.println(gFont.descent);
 #endif
 
- fontFile.seek(headerPtr, fs::SeekSet);
+ source->seek(headerPtr);
 
   uint16_t gNum = 0;
+  bool sorted = true; // Cleared if the file glyphs are not in ascending Unicode order
+  uint16_t maxAdvance = 0, maxSize = 0;
+
+  // Glyph records are read a chunk at a time rather than byte by byte
+  uint8_t  chunk[SMOOTH_METRICS_CHUNK * 28];
+  uint8_t* record = chunk;
+  uint16_t recordsLeft = 0;
 
   while (gNum < gFont.gCount)
   {
-    gUnicode[gNum]  = (uint16_t)readInt32(); // Unicode code point value
-    gHeight[gNum]   =  (uint8_t)readInt32(); // Height of glyph
-    gWidth[gNum]    =  (uint8_t)readInt32(); // Width of glyph
-    gxAdvance[gNum] =  (uint8_t)readInt32(); // xAdvance - to move x cursor
-    gdY[gNum]       =  (int16_t)readInt32(); // y delta from baseline
-    gdX[gNum]       =   (int8_t)readInt32(); // x delta from cursor
-    readInt32(); // ignored
+    if (!recordsLeft)
+    {
+      recordsLeft = gFont.gCount - gNum;
+      if (recordsLeft > SMOOTH_METRICS_CHUNK) recordsLeft = SMOOTH_METRICS_CHUNK;
+      if (source->read(chunk, recordsLeft * 28) != recordsLeft * 28u)
+      {
+        // Truncated file
+        unloadFont();
+        return;
+      }
+      record = chunk;
+      yield();
+    }
+
+    gUnicode[gNum]  = (uint16_t)readInt32(record);      // Unicode code point value
+    gHeight[gNum]   =  (uint8_t)readInt32(record + 4);  // Height of glyph
+    gWidth[gNum]    =  (uint8_t)readInt32(record + 8);  // Width of glyph
+    gxAdvance[gNum] =  (uint8_t)readInt32(record + 12); // xAdvance - to move x cursor
+    gdY[gNum]       =  (int16_t)readInt32(record + 16); // y delta from baseline
+    gdX[gNum]       =   (int8_t)readInt32(record + 20); // x delta from cursor
+                                                         // record + 24 ignored
+    record += 28;
+    recordsLeft--;
 
     if(!_metadataLoaded) {
       if (gUnicode[gNum] == 0x20) {
@@ -212,15 +302,216 @@ void TFT_eSPI_SmoothFont::loadMetrics(void)
 
     bitmapPtr += gWidth[gNum] * gHeight[gNum];
 
+    if (gNum && (gUnicode[gNum] <= gUnicode[gNum - 1])) sorted = false;
+
+    if (gxAdvance[gNum] > maxAdvance) maxAdvance = gxAdvance[gNum];
+    if (gWidth[gNum] * gHeight[gNum] > maxSize) maxSize = gWidth[gNum] * gHeight[gNum];
+
     gNum++;
-    yield();
   }
 
+  buildIndex(sorted);
+  // Glyphs are read into the scratch space, so the font cannot be used without it
+  if (!allocScratch(maxAdvance, maxSize)) { unloadFont(); return; }
+
+  fontLoaded = true;
+  _metadataLoaded = true;
+
+  _loadDuration = micros() - startTime;
+
+}
+
+
+/***************************************************************************************
+** Function name:           mapMetrics
+** Description:             Point the glyph metric arrays into the gBitmap block
+*************************************************************************************x*/
+void TFT_eSPI_SmoothFont::mapMetrics(void)
+{
+  // Widest types first so every array is aligned, 12 bytes per glyph in total
+  gUnicode  = (uint16_t*)(gBitmap + gFont.gCount);    // Unicode 16 bit Basic Multilingual Plane (0-FFFF)
+  gdY       =  (int16_t*)(gUnicode + gFont.gCount);   // offset from bitmap top edge from lowest point in any character
+  gHeight   =  (uint8_t*)(gdY + gFont.gCount);        // Height of glyph
+  gWidth    =            gHeight + gFont.gCount;      // Width of glyph
+  gxAdvance =            gWidth + gFont.gCount;       // xAdvance - to move x cursor
+  gdX       =   (int8_t*)(gxAdvance + gFont.gCount);  // offset for bitmap left edge relative to cursor X
+}
+
+
+/***************************************************************************************
+** Function name:           allocScratch
+** Description:             Reserve the drawGlyph() scratch space, false if no RAM
+*************************************************************************************x*/
+bool TFT_eSPI_SmoothFont::allocScratch(uint16_t maxAdvance, uint16_t maxSize)
+{
+  // A background cell wide enough for any glyph advance (missing glyphs
+  // use spaceWidth + 4) and the largest greyscale bitmap
+  if (gFont.spaceWidth + 4 > maxAdvance) maxAdvance = gFont.spaceWidth + 4;
+  size_t cellSize = gFont.yAdvance * maxAdvance * 2;
+  _scratchSize = cellSize + maxSize;
+  gCell = (uint16_t*)malloc(_scratchSize);
+  if (!gCell) return false;
+
+  gGrey = (uint8_t*)gCell + cellSize;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           readIndexHeader
+** Description:             Get the font metrics from an indexed font header
+*************************************************************************************x*/
+bool TFT_eSPI_SmoothFont::readIndexHeader(const uint8_t *header)
+{
+  if (header[0] != 'V' || header[1] != 'L' || header[2] != 'I' || header[3] != 1) return false;
+  if (header[24] != 8 && header[24] != 4 && header[24] != 2) return false;
+
+  // Header values are little endian
+  gFont.gCount     = header[4]  | (header[5]  << 8);
+  gFont.height     = header[6]  | (header[7]  << 8);
+  gFont.ascent     = header[8]  | (header[9]  << 8);
+  gFont.descent    = header[10] | (header[11] << 8);
+  gFont.maxAscent  = header[12] | (header[13] << 8);
+  gFont.maxDescent = header[14] | (header[15] << 8);
+  gFont.yAdvance   = header[16] | (header[17] << 8);
+  gFont.spaceWidth = header[18] | (header[19] << 8);
+  _maxAdvance      = header[20] | (header[21] << 8);
+  _maxSize         = header[22] | (header[23] << 8);
+  _bpp             = header[24];
+
+  _indexed = true;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           loadIndex
+** Description:             Load or map the metrics of an indexed font
+*************************************************************************************x*/
+void TFT_eSPI_SmoothFont::loadIndex(void)
+{
+  /*
+    The indexed font (.vli) is made from a vlw file by Tools/Convert_Smooth_Font/vlw2vli.py
+    with the work done by loadMetrics() already done, so the metrics can be used as stored.
+    All values are little endian.
+
+    Header, 28 bytes:
+      0  "VLI" and format version 1
+      4  uint16_t gCount, height
+      8  int16_t  ascent, descent
+      12 uint16_t maxAscent, maxDescent, yAdvance, spaceWidth
+      20 uint16_t widest gxAdvance, largest gWidth x gHeight
+      24 uint8_t  bits per pixel of the bitmaps, 8, 4 or 2
+      25 3 bytes reserved, 0
+
+    Metrics, 12 bytes per glyph, sorted by Unicode so getUnicodeIndex() can binary search:
+      uint32_t gBitmap[gCount]   offset of the bitmap from the start of the font
+      uint16_t gUnicode[gCount]
+      int16_t  gdY[gCount]
+      uint8_t  gHeight[gCount], gWidth[gCount], gxAdvance[gCount]
+      int8_t   gdX[gCount]
+
+    Bitmaps follow, 4 byte aligned. Packed 4 and 2 bpp pixels are stored high bits first,
+    rows are not padded so a glyph takes (gWidth x gHeight x bpp + 7) / 8 bytes.
+  */
+
+  unsigned long startTime = micros();
+
+  size_t tableSize = gFont.gCount * 12;
+
+  // Use the metrics where they are if the source can be read in place and is aligned
+  const uint8_t* table = source->pointer(VLI_HEADER_SIZE);
+  _metricsInPlace = table && !((uintptr_t)table & 3);
+
+  if (_metricsInPlace) gBitmap = (uint32_t*)table;
+  else
+  {
+    gBitmap = (uint32_t*)malloc(tableSize);
+    if (!gBitmap) { source->close(); return; }
+
+    // All the metrics in one read
+    source->seek(VLI_HEADER_SIZE);
+    if (source->read((uint8_t*)gBitmap, tableSize) != tableSize)
+    {
+      unloadFont();
+      return;
+    }
+  }
+
+  mapMetrics();
+  buildIndex(true);
+  if (!allocScratch(_maxAdvance, _maxSize)) { unloadFont(); return; }
+
+  fontLoaded = true;
+  _metadataLoaded = true;
+
+  _loadDuration = micros() - startTime;
+}
+
 
+/***************************************************************************************
+** Function name:           loadCompiled
+** Description:             Point the metrics at the tables of a compiled font
+*************************************************************************************x*/
+void TFT_eSPI_SmoothFont::loadCompiled(void)
+{
+  unsigned long startTime = micros();
+
+  gFont       = _compiled->metrics;
+  _maxAdvance = _compiled->maxAdvance;
+  _maxSize    = _compiled->maxSize;
+  _bpp        = _compiled->bpp;
+
+  // The bitmap offsets are from the start of the bitmaps array, the font source
+  gBitmap   = (uint32_t*)_compiled->bitmap;
+  gUnicode  = (uint16_t*)_compiled->unicode;
+  gdY       =  (int16_t*)_compiled->dY;
+  gHeight   =  (uint8_t*)_compiled->height;
+  gWidth    =  (uint8_t*)_compiled->width;
+  gxAdvance =  (uint8_t*)_compiled->xAdvance;
+  gdX       =   (int8_t*)_compiled->dX;
+  _metricsInPlace = true;
+
+  buildIndex(true);
+  if (!allocScratch(_maxAdvance, _maxSize)) { unloadFont(); return; }
 
   fontLoaded = true;
   _metadataLoaded = true;
 
+  _loadDuration = micros() - startTime;
+}
+
+
+/***************************************************************************************
+** Function name:           buildIndex
+** Description:             Create the lookup tables used by getUnicodeIndex
+*************************************************************************************x*/
+void TFT_eSPI_SmoothFont::buildIndex(bool sorted)
+{
+  // Printable ASCII is looked up directly, first glyph wins if a code is repeated
+  for (uint16_t i = 0; i < 0x7F - 0x20; i++) gAscii[i] = NO_GLYPH;
+
+  for (uint16_t gNum = 0; gNum < gFont.gCount; gNum++)
+  {
+    uint16_t code = gUnicode[gNum];
+    if ((code >= 0x20) && (code < 0x7F) && (gAscii[code - 0x20] == NO_GLYPH)) gAscii[code - 0x20] = gNum;
+  }
+
+  // Fonts created by the Processing sketch are already in Unicode order so can be
+  // binary searched in place, otherwise keep a sorted list of glyph numbers (2 bytes/glyph)
+  _unicodeSorted = sorted;
+  if (sorted) return;
+
+  gSorted = (uint16_t*)malloc( gFont.gCount * 2);
+  if (!gSorted) return; // getUnicodeIndex() falls back to a linear search
+
+  for (uint16_t gNum = 0; gNum < gFont.gCount; gNum++) gSorted[gNum] = gNum;
+
+  // Order by code then glyph number so repeated codes find the first glyph, as before
+  uint16_t* unicode = gUnicode;
+  std::sort(gSorted, gSorted + gFont.gCount, [unicode](uint16_t a, uint16_t b) {
+    return (unicode[a] < unicode[b]) || ((unicode[a] == unicode[b]) && (a < b));
+  });
 }
 
 
@@ -230,65 +521,370 @@ void TFT_eSPI_SmoothFont::loadMetrics(void)
 *************************************************************************************x*/
 void TFT_eSPI_SmoothFont::unloadFont( void )
 {
-  if (gUnicode)
+  if (gBitmap)
+  {
+    if (!_metricsInPlace) free(gBitmap); // All the glyph metrics are in the same allocation
+    _metricsInPlace = false;
+    gBitmap   = NULL;
+    gUnicode  = NULL;
+    gHeight   = NULL;
+    gWidth    = NULL;
+    gxAdvance = NULL;
+    gdY       = NULL;
+    gdX       = NULL;
+  }
+
+  if (gSorted)
+  {
+    free(gSorted);
+    gSorted = NULL;
+  }
+
+  if (gCell)
+  {
+    free(gCell); // gGrey is in the same allocation, _scratchSize is kept for metricsSize()
+    gCell = NULL;
+    gGrey = NULL;
+  }
+
+  clearGlyphCache();
+
+  endPrefetch();
+
+  if (source) source->close();
+  fontLoaded = false;
+}
+
+
+/***************************************************************************************
+** Function name:           setGlyphCache
+** Description:             Set the RAM budget for cached glyph bitmaps
+*************************************************************************************x*/
+void TFT_eSPI_SmoothFont::setGlyphCache(size_t bytes, uint8_t bpp)
+{
+  if (bpp != 4 && bpp != 2) bpp = 8;
+  if (bpp != _cacheBpp) clearGlyphCache();
+
+  _cacheBpp = bpp;
+  _cacheBudget = bytes;
+
+  while (_cacheTail && (cacheStats.bytes > _cacheBudget)) evictGlyph();
+}
+
+
+/***************************************************************************************
+** Function name:           clearGlyphCache
+** Description:             Free all cached glyph bitmaps
+*************************************************************************************x*/
+void TFT_eSPI_SmoothFont::clearGlyphCache(void)
+{
+  while (_cacheHead)
   {
-    free(gUnicode);
-    gUnicode = NULL;
+    glyphCacheEntry* entry = _cacheHead;
+    _cacheHead = entry->next;
+    free(entry);
   }
 
-  if (gHeight)
+  _cacheTail = NULL;
+  for (uint8_t i = 0; i < GLYPH_CACHE_BUCKETS; i++) _cacheBucket[i] = NULL;
+  cacheStats.bytes = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           evictGlyph
+** Description:             Free the least recently used glyph bitmap
+*************************************************************************************x*/
+void TFT_eSPI_SmoothFont::evictGlyph(void)
+{
+  glyphCacheEntry* entry = _cacheTail;
+  if (!entry) return;
+
+  // Unlink from hash bucket
+  glyphCacheEntry** link = &_cacheBucket[entry->gNum & (GLYPH_CACHE_BUCKETS - 1)];
+  while (*link != entry) link = &(*link)->chain;
+  *link = entry->chain;
+
+  // Unlink from LRU list tail
+  _cacheTail = entry->prev;
+  if (_cacheTail) _cacheTail->next = NULL;
+  else _cacheHead = NULL;
+
+  cacheStats.bytes -= sizeof(glyphCacheEntry) + entry->size;
+  cacheStats.evictions++;
+  free(entry);
+}
+
+
+/***************************************************************************************
+** Function name:           cachedGlyph
+** Description:             Get a glyph bitmap from the cache, read it in on a miss
+*************************************************************************************x*/
+const uint8_t* TFT_eSPI_SmoothFont::cachedGlyph(uint16_t gNum)
+{
+  if (!_cacheBudget || !fontLoaded) return NULL;
+
+  glyphCacheEntry** bucket = &_cacheBucket[gNum & (GLYPH_CACHE_BUCKETS - 1)];
+  glyphCacheEntry*  entry  = *bucket;
+
+  while (entry && (entry->gNum != gNum)) entry = entry->chain;
+
+  if (entry)
   {
-    free(gHeight);
-    gHeight = NULL;
+    cacheStats.hits++;
+
+    // Move to head of LRU list
+    if (entry != _cacheHead)
+    {
+      entry->prev->next = entry->next;
+      if (entry->next) entry->next->prev = entry->prev;
+      else _cacheTail = entry->prev;
+
+      entry->prev = NULL;
+      entry->next = _cacheHead;
+      _cacheHead->prev = entry;
+      _cacheHead = entry;
+    }
+    return (uint8_t*)(entry + 1);
   }
 
-  if (gWidth)
+  uint8_t  bpp  = cacheBpp();
+  uint16_t size = packedSize(gWidth[gNum] * gHeight[gNum], bpp);
+  size_t   need = sizeof(glyphCacheEntry) + size;
+
+  if ((bpp != _bpp) && !gGrey) return NULL; // No space to convert
+
+  if (need > _cacheBudget) return NULL; // Never fits
+
+  while (_cacheTail && (cacheStats.bytes + need > _cacheBudget)) evictGlyph();
+
+  entry = (glyphCacheEntry*)malloc(need);
+  if (!entry) return NULL;
+
+  uint8_t* bitmap = (uint8_t*)(entry + 1);
+
+  if (bpp == _bpp) readGlyph(gNum, bitmap);
+  else
   {
-    free(gWidth);
-    gWidth = NULL;
+    // Repack from the font bpp, rounding to the nearest level
+    uint16_t pixels = gWidth[gNum] * gHeight[gNum];
+    uint8_t  levels = (1 << bpp) - 1;
+    uint8_t  shift  = 8 - bpp;
+
+    readGlyph(gNum, gGrey);
+    memset(bitmap, 0, size);
+
+    for (uint16_t i = 0; i < pixels; i++)
+    {
+      uint8_t level = (glyphAlpha(gGrey, _bpp, i) * levels + 127) / 255;
+      bitmap[(i * bpp) >> 3] |= level << (shift - ((i * bpp) & 7));
+    }
+  }
+
+  entry->gNum  = gNum;
+  entry->size  = size;
+  entry->chain = *bucket;
+  *bucket = entry;
+
+  entry->prev = NULL;
+  entry->next = _cacheHead;
+  if (_cacheHead) _cacheHead->prev = entry;
+  else _cacheTail = entry;
+  _cacheHead = entry;
+
+  cacheStats.bytes += need;
+  cacheStats.misses++;
+
+  return (uint8_t*)(entry + 1);
+}
+
+
+/***************************************************************************************
+** Function name:           glyphBitmap
+** Description:             Get a glyph bitmap from the cache or the font
+*************************************************************************************x*/
+const uint8_t* TFT_eSPI_SmoothFont::glyphBitmap(uint16_t gNum, uint8_t *bpp)
+{
+  const uint8_t* bitmap;
+
+  // Draw straight from the font if it can be read in place, unless a cache has been set
+  // up e.g. to hold glyphs from slow flash in RAM or at fewer bits per pixel
+  if (!_cacheBudget) {
+    bitmap = source->pointer(gBitmap[gNum]);
+    if (bitmap) {
+      *bpp = _bpp;
+      return bitmap;
+    }
+  }
+
+  bitmap = cachedGlyph(gNum);
+  if (bitmap) {
+    *bpp = cacheBpp();
+    return bitmap;
   }
 
-  if (gxAdvance)
+  *bpp = _bpp;
+
+  bitmap = fetchedGlyph(gNum);
+  if (bitmap) return bitmap;
+
+  readGlyph(gNum, gGrey);
+  return gGrey;
+}
+
+
+/***************************************************************************************
+** Function name:           prefetchGlyphs
+** Description:             Read a list of glyph bitmaps in font order
+*************************************************************************************x*/
+void TFT_eSPI_SmoothFont::prefetchGlyphs(uint16_t *gNum, uint16_t count)
+{
+  endPrefetch();
+
+  if (!fontLoaded || !count) return;
+
+  // Glyphs drawn in place are not read at all
+  if (!_cacheBudget && source->pointer(0)) return;
+
+  // Font order, repeated glyphs are next to each other so can be removed
+  uint32_t* offset = gBitmap;
+  std::sort(gNum, gNum + count, [offset](uint16_t a, uint16_t b) {
+    return (offset[a] < offset[b]) || ((offset[a] == offset[b]) && (a < b));
+  });
+  count = std::unique(gNum, gNum + count) - gNum;
+
+  // Misses are read into the cache in font order, drawing then finds every glyph in RAM
+  if (_cacheBudget) {
+    for (uint16_t i = 0; i < count; i++) cachedGlyph(gNum[i]);
+    return;
+  }
+
+  // Group the bitmaps into spans, a small gap is read rather than seeked over. Stop
+  // at the first glyph that does not fit in the buffer.
+  uint16_t spans = 0, fetch = 0;
+  uint32_t bytes = 0, end = 0;
+
+  for (; fetch < count; fetch++)
   {
-    free(gxAdvance);
-    gxAdvance = NULL;
+    uint32_t start = offset[gNum[fetch]];
+    uint32_t stop  = start + packedSize(gWidth[gNum[fetch]] * gHeight[gNum[fetch]], _bpp);
+    if (stop == start) continue;
+
+    bool     join = spans && (start <= end + SMOOTH_PREFETCH_GAP);
+    uint32_t add  = join ? ((stop > end) ? stop - end : 0) : stop - start;
+
+    if ((spans + !join) * sizeof(fetchSpan) + bytes + add > SMOOTH_PREFETCH_BYTES) break;
+
+    if (!join) spans++;
+    bytes += add;
+    if (stop > end) end = stop;
   }
 
-  if (gdY)
+  if (!spans) return;
+
+  _fetchSpan = (fetchSpan*)malloc(spans * sizeof(fetchSpan) + bytes);
+  if (!_fetchSpan) return;
+
+  // Same grouping again, now filling in the spans
+  fetchSpan* span = _fetchSpan - 1;
+  uint32_t   at   = 0;
+
+  for (uint16_t i = 0; i < fetch; i++)
   {
-    free(gdY);
-    gdY = NULL;
+    uint32_t start = offset[gNum[i]];
+    uint32_t stop  = start + packedSize(gWidth[gNum[i]] * gHeight[gNum[i]], _bpp);
+    if (stop == start) continue;
+
+    if ((span >= _fetchSpan) && (start <= span->end + SMOOTH_PREFETCH_GAP)) {
+      if (stop > span->end) span->end = stop;
+      continue;
+    }
+
+    if (span >= _fetchSpan) at += span->end - span->start;
+    span++;
+    span->start = start;
+    span->end   = stop;
+    span->at    = at;
   }
 
-  if (gdX)
+  // One seek and one read per span, moving forward through the font
+  _fetchData = (uint8_t*)(_fetchSpan + spans);
+
+  for (uint16_t i = 0; i < spans; i++)
   {
-    free(gdX);
-    gdX = NULL;
+    uint32_t length = _fetchSpan[i].end - _fetchSpan[i].start;
+    source->seek(_fetchSpan[i].start);
+    if (source->read(_fetchData + _fetchSpan[i].at, length) != length) break;
+    _fetchSpans = i + 1;
   }
+}
 
-  if (gBitmap)
+
+/***************************************************************************************
+** Function name:           endPrefetch
+** Description:             Free the prefetch buffer
+*************************************************************************************x*/
+void TFT_eSPI_SmoothFont::endPrefetch(void)
+{
+  free(_fetchSpan);
+  _fetchSpan  = NULL;
+  _fetchData  = NULL;
+  _fetchSpans = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           fetchedGlyph
+** Description:             Find a glyph bitmap in the prefetch buffer
+*************************************************************************************x*/
+const uint8_t* TFT_eSPI_SmoothFont::fetchedGlyph(uint16_t gNum)
+{
+  if (!_fetchSpans) return NULL;
+
+  uint32_t start = gBitmap[gNum];
+  uint32_t stop  = start + packedSize(gWidth[gNum] * gHeight[gNum], _bpp);
+
+  // Binary search for the last span starting at or before the bitmap
+  uint16_t lo = 0, hi = _fetchSpans;
+  while (hi - lo > 1)
   {
-    free(gBitmap);
-    gBitmap = NULL;
+    uint16_t mid = (lo + hi) >> 1;
+    if (_fetchSpan[mid].start <= start) lo = mid;
+    else hi = mid;
   }
 
-  fontFile.close();
-  fontLoaded = false;
+  fetchSpan* span = _fetchSpan + lo;
+  if ((start < span->start) || (stop > span->end)) return NULL;
+
+  return _fetchData + span->at + start - span->start;
+}
+
+
+/***************************************************************************************
+** Function name:           readGlyph
+** Description:             Read a glyph bitmap as stored in the font
+*************************************************************************************x*/
+void TFT_eSPI_SmoothFont::readGlyph(uint16_t gNum, uint8_t *buffer)
+{
+  uint16_t size = packedSize(gWidth[gNum] * gHeight[gNum], _bpp);
+
+  source->seek(gBitmap[gNum]);
+  source->read(buffer, size);
 }
 
 
 /***************************************************************************************
 ** Function name:           readInt32
-** Description:             Get a 32 bit integer from the font file
+** Description:             Get a big endian 32 bit integer from a font file buffer
 *************************************************************************************x*/
-uint32_t TFT_eSPI_SmoothFont::readInt32(void)
+uint32_t TFT_eSPI_SmoothFont::readInt32(const uint8_t *buffer)
 {
   uint32_t val = 0;
 
-  val |= fontFile.read() << 24;
-  val |= fontFile.read() << 16;
-  val |= fontFile.read() << 8;
-  val |= fontFile.read();
+  val |= (uint32_t)buffer[0] << 24;
+  val |= buffer[1] << 16;
+  val |= buffer[2] << 8;
+  val |= buffer[3];
   return val;
 }
 
@@ -299,11 +895,45 @@ uint32_t TFT_eSPI_SmoothFont::readInt32(void)
 *************************************************************************************x*/
 bool TFT_eSPI_SmoothFont::getUnicodeIndex(uint16_t unicode, uint16_t *index)
 {
-  for (uint16_t i = 0; i < gFont.gCount; i++)
+  // Direct table for printable ASCII
+  if ((unicode >= 0x20) && (unicode < 0x7F))
+  {
+    uint16_t gNum = gAscii[unicode - 0x20];
+    if (gNum == NO_GLYPH) return false;
+    *index = gNum;
+    return true;
+  }
+
+  // Unsorted font and no RAM for the index, so search every glyph
+  if (!_unicodeSorted && !gSorted)
+  {
+    for (uint16_t i = 0; i < gFont.gCount; i++)
+    {
+      if (gUnicode[i] == unicode)
+      {
+        *index = i;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Binary search for the first glyph with a code >= unicode
+  uint32_t lo = 0, hi = gFont.gCount;
+  while (lo < hi)
+  {
+    uint32_t mid = (lo + hi) >> 1;
+    uint16_t gNum = gSorted ? gSorted[mid] : mid;
+    if (gUnicode[gNum] < unicode) lo = mid + 1;
+    else hi = mid;
+  }
+
+  if (lo < gFont.gCount)
   {
-    if (gUnicode[i] == unicode)
+    uint16_t gNum = gSorted ? gSorted[lo] : lo;
+    if (gUnicode[gNum] == unicode)
     {
-      *index = i;
+      *index = gNum;
       return true;
     }
   }
@@ -2,28 +2,111 @@
  // This is part of the TFT_eSPI class and is associated with anti-aliased font functions
 #pragma once
 #include <map>
+#include "FontSource.h"
+
+// Compiled font metric tables are read in place, the ESP8266 can only read PROGMEM
+// 32 bits at a time so they are held in RAM. The bitmaps are always in PROGMEM.
+#if defined (ESP8266)
+  #define SMOOTH_FONT_TABLE
+#else
+  #define SMOOTH_FONT_TABLE PROGMEM
+#endif
+
 class TFT_eSPI_SmoothFont {
 
  private:
   static std::map<String, TFT_eSPI_SmoothFont *  > Fonts;
 
-  String    fontPath;
+  // Font residency, fonts in the Fonts map are unloaded least recently used first
+  // to keep the RAM they hold within the budget
+  static size_t   _residentBudget;
+  static uint32_t _useClock;        // Counts font uses, orders fonts by last use
+  uint32_t  _lastUse = 0;           // _useClock value when this font was last used
+  bool      _pinned = false;        // Font is never unloaded to make room for another
+  static void makeRoom(size_t bytes, TFT_eSPI_SmoothFont *keep);
+
+  String    fontPath;                // Font file path, the key in the Fonts map
+  TFT_eSPI_FontSource* source = NULL; // Where the font data is read from
+  bool      _ownSource = false;      // source was created by a constructor so is deleted with the font
   bool      fontLoaded = false;
   bool      _metadataLoaded = false;
-  unsigned long _lastLoadTime = 0L;
+  bool      _unicodeSorted = false;
+  unsigned long _loadDuration = 0L;
   void      loadMetrics(void);
-  uint32_t  readInt32(void);
+  void      buildIndex(bool sorted);
+  void      mapMetrics(void);
+  bool      allocScratch(uint16_t maxAdvance, uint16_t maxSize);
+  uint32_t  readInt32(const uint8_t *buffer);
+
+  // Indexed font container, see loadIndex() for the format
+  #define VLI_HEADER_SIZE 28
+  bool      _indexed = false;        // Font is in the indexed format
+  bool      _metricsInPlace = false; // Metric arrays point into the font source so are not freed
+  uint8_t   _bpp = 8;                // Glyph bitmap bits per pixel, 8, 4 or 2
+  uint16_t  _maxAdvance = 0;         // Widest glyph advance, from the indexed font header
+  uint16_t  _maxSize = 0;            // Largest glyph bitmap in pixels, from the indexed font header
+  bool      readIndexHeader(const uint8_t *header);
+  void      loadIndex(void);
+
+  #define SMOOTH_METRICS_CHUNK 16 // Glyph records (28 bytes each) read from the file at a time
+
+  // Glyph bitmap cache entry, the greyscale bitmap follows the entry in the same allocation
+  typedef struct glyphCacheEntry
+  {
+    glyphCacheEntry* prev;  // LRU list, head is the most recently used
+    glyphCacheEntry* next;
+    glyphCacheEntry* chain; // Next entry in the same hash bucket
+    uint16_t gNum;          // Glyph number in this font
+    uint16_t size;          // Bitmap bytes
+  } glyphCacheEntry;
+
+  #define GLYPH_CACHE_BUCKETS 32 // Must be a power of 2
+  glyphCacheEntry* _cacheBucket[GLYPH_CACHE_BUCKETS] = { NULL };
+  glyphCacheEntry* _cacheHead = NULL;
+  glyphCacheEntry* _cacheTail = NULL;
+  size_t    _cacheBudget = 0;  // Glyph cache RAM limit in bytes, 0 = cache disabled
+  uint8_t   _cacheBpp = 8;     // Bits per pixel of cached bitmaps, 8, 4 or 2
+  size_t    _scratchSize = 0;  // Bytes allocated to gCell and gGrey, kept when unloaded
+
+  void      evictGlyph(void);
+  void      readGlyph(uint16_t gNum, uint8_t *buffer);
+
+  // Glyph prefetch, the bitmaps of a string are read in font order, see prefetchGlyphs()
+  #define SMOOTH_PREFETCH_GAP 128 // Gap between bitmaps read rather than seeked over, bytes
+
+  typedef struct
+  {
+    uint32_t start;         // Font offset of the first byte
+    uint32_t end;           // Font offset after the last byte
+    uint32_t at;            // Position of the first byte in the prefetch data
+  } fetchSpan;
+
+  fetchSpan* _fetchSpan = NULL; // Prefetch buffer, the spans are followed by the bitmap data
+  uint8_t*  _fetchData = NULL;  // Bitmap data in the prefetch buffer
+  uint16_t  _fetchSpans = 0;    // Spans in the buffer, ascending font offset
+
+  const uint8_t* fetchedGlyph(uint16_t gNum);
 
   
  public:
-  TFT_eSPI_SmoothFont(String path) : fontPath(path){ };
+#ifdef FONT_FS_AVAILABLE
+  TFT_eSPI_SmoothFont(String path) : TFT_eSPI_SmoothFont(SPIFFS, path){ };
+           // Font file in another file system e.g. LittleFS or SD
+  TFT_eSPI_SmoothFont(fs::FS &fs, String path) : fontPath(path),
+           source(new TFT_eSPI_FontSourceFS(fs, path)), _ownSource(true){ };
+#endif
+           // Font held in a memory or PROGMEM array, an indexed font (.vli) is used in place
+  TFT_eSPI_SmoothFont(const uint8_t *array) : source(new TFT_eSPI_FontSourceArray(array)), _ownSource(true){ };
+           // Font read from a source owned by the caller, it must exist as long as the font
+  TFT_eSPI_SmoothFont(TFT_eSPI_FontSource *fontSource) : source(fontSource){ };
   void   loadFont();
 
-  static TFT_eSPI_SmoothFont *  const require(const String & path) {
+#ifdef FONT_FS_AVAILABLE
+  static TFT_eSPI_SmoothFont *  const require(const String & path, fs::FS &fs = SPIFFS) {
 
     if (Fonts.find(path) == TFT_eSPI_SmoothFont::Fonts.end()){
 
-      TFT_eSPI_SmoothFont::Fonts.insert({path, new TFT_eSPI_SmoothFont(path)});
+      TFT_eSPI_SmoothFont::Fonts.insert({path, new TFT_eSPI_SmoothFont(fs, path)});
     }
      auto font = TFT_eSPI_SmoothFont::Fonts.at(path);
     if (!font->metadataLoaded()) {
@@ -31,24 +114,89 @@ class TFT_eSPI_SmoothFont {
     }    
     return font;
   };
+#endif
+
+
+
+           // Mark the font as used and reload it if it has been unloaded to make room
+           // for another font. Returns false if the font cannot be loaded.
+  bool     use() {
+               _lastUse = ++_useClock;
+               if (!fontLoaded) loadFont();
+               return fontLoaded;
+           };
+
+           // Keep the font loaded, it is never unloaded to make room for other fonts
+  void     setPinned(bool pinned) {_pinned = pinned;};
+  bool     pinned() {return _pinned;};
 
+           // Set the RAM budget for fonts loaded from files, default SMOOTH_FONT_BUDGET.
+           // Least recently used fonts that are not pinned are unloaded to stay within it.
+  static void   setResidentBudget(size_t bytes);
+           // RAM held by the loaded font files, metrics, drawing scratch space and glyph caches
+  static size_t residentBytes(void);
 
+  // Font residency statistics
+  typedef struct
+  {
+    uint32_t loads;                  // Fonts loaded for the first time
+    uint32_t reloads;                // Fonts loaded again after being unloaded
+    uint32_t evictions;              // Fonts unloaded to stay within the budget
+    uint32_t reloadMicros;           // Total time spent reloading fonts
+  } residencyStats;
+
+  static residencyStats residency;
 
   virtual ~TFT_eSPI_SmoothFont() {
     unloadFont();
+    if (_ownSource) delete source;
   };
   // These are for the new antialiased fonts
   
   void     unloadFont( void );
   bool     getUnicodeIndex(uint16_t unicode, uint16_t *index);
 
+           // Glyph bitmap RAM cache, avoids a file seek and read for recently drawn glyphs
+           // The least recently used glyphs are discarded to keep within the byte budget
+           // Set the RAM budget, 0 (default) disables the cache. Bitmaps can be cached at 4 or
+           // 2 bits per pixel to fit 2 or 4 times as many glyphs, at the cost of fewer grey levels.
+  void     setGlyphCache(size_t bytes, uint8_t bpp = 8);
+  void     clearGlyphCache(void);        // Discard all cached glyphs, budget is not changed
+           // Return the glyph bitmap from the cache, reading it in on a miss. Returns NULL if the
+           // cache is disabled or the glyph cannot be cached. The bitmap is packed at cacheBpp().
+  const uint8_t* cachedGlyph(uint16_t gNum);
+           // Read the bitmaps of a list of glyphs (e.g. those in a string) in one forward pass
+           // through the font, to be used by the drawing that follows. The list is sorted and
+           // repeated glyphs removed. Bitmaps go into the glyph cache if it is enabled, otherwise
+           // into a prefetch buffer of up to SMOOTH_PREFETCH_BYTES, glyphs that do not fit are
+           // read when drawn. Nothing is read if the font source can be drawn in place.
+  void     prefetchGlyphs(uint16_t *gNum, uint16_t count);
+  void     endPrefetch(void);            // Free the prefetch buffer once the glyphs are drawn
+  uint8_t  cacheBpp() {return (_cacheBpp < _bpp) ? _cacheBpp : _bpp;};
+           // Return the bitmap of a glyph and its bits per pixel. With no glyph cache the bitmap
+           // is in the font itself if the source can be read in place, else it is from the
+           // prefetch buffer or read into gGrey.
+  const uint8_t* glyphBitmap(uint16_t gNum, uint8_t *bpp);
+
+           // Bytes used by a bitmap of pixels at bpp bits per pixel
+  static uint16_t packedSize(uint16_t pixels, uint8_t bpp) {return ((uint32_t)pixels * bpp + 7) >> 3;};
+
+           // Alpha (0-255) of pixel i in a bitmap packed at bpp bits per pixel. Packed pixels
+           // are stored high bits first with no padding at the end of a row.
+  static uint8_t glyphAlpha(const uint8_t *bitmap, uint8_t bpp, uint16_t i) {
+               if (bpp == 4) return ((bitmap[i >> 1] >> ((~i & 1) << 2)) & 0x0F) * 0x11;
+               if (bpp == 2) return ((bitmap[i >> 2] >> ((~i & 3) << 1)) & 0x03) * 0x55;
+               return bitmap[i];
+           };
+
   bool     loaded() {return fontLoaded;};
   bool     metadataLoaded() {return _metadataLoaded;};
-  unsigned long lastLoadTime() {return _lastLoadTime;};
+  uint32_t lastUse() {return _lastUse;};
+  unsigned long loadDuration() {return _loadDuration;}; // Microseconds taken by the last metrics load
 
   size_t   metricsSize() {
       if (_metadataLoaded) {
-        return gFont.gCount * 12; //Allocated size
+        return ((_metricsInPlace || _compiled) ? 0 : gFont.gCount * 12) + (_unicodeSorted ? 0 : gFont.gCount * 2) + _scratchSize; //Allocated size, also once unloaded
       }
       else {
         return 0;
@@ -70,18 +218,63 @@ class TFT_eSPI_SmoothFont {
 
 fontMetrics gFont = { 0, 0, 0, 0, 0, 0, 0, 0 };
 
+  // Font compiled into the sketch as constant tables by Tools/Convert_Smooth_Font/font2h.
+  // The tables are used where they are, so no font file is read or parsed and the glyph
+  // metrics take no RAM. Glyphs are sorted by Unicode, bitmaps are packed as in a vli font.
+  typedef struct
+  {
+    fontMetrics     metrics;         // Whole font metrics, as found by loadMetrics()
+    uint16_t        maxAdvance;      // Widest glyph advance
+    uint16_t        maxSize;         // Largest glyph bitmap, gWidth x gHeight pixels
+    uint8_t         bpp;             // Bits per pixel of the bitmaps, 8, 4 or 2
+    const uint32_t* bitmap;          // Offset of each glyph bitmap in bitmaps
+    const uint16_t* unicode;         // Glyph codes in ascending order
+    const int16_t*  dY;
+    const uint8_t*  height;
+    const uint8_t*  width;
+    const uint8_t*  xAdvance;
+    const int8_t*   dX;
+    const uint8_t*  bitmaps;         // PROGMEM glyph bitmaps
+  } compiledFont;
+
+           // Compiled font, the tables must exist as long as the font
+  TFT_eSPI_SmoothFont(const compiledFont &font) : source(new TFT_eSPI_FontSourceArray(font.bitmaps)),
+           _ownSource(true), _compiled(&font){ };
+
+ private:
+  const compiledFont* _compiled = NULL; // Tables of a compiled font, NULL for other fonts
+  void      loadCompiled(void);
+
+ public:
+
+  // Glyph cache statistics
+  typedef struct
+  {
+    uint32_t hits;                   // Glyph bitmaps found in the cache
+    uint32_t misses;                 // Glyph bitmaps read from the file into the cache
+    uint32_t evictions;              // Glyph bitmaps discarded to make space
+    size_t   bytes;                  // RAM in use by the cache, including entry overhead
+  } glyphCacheStats;
+
+glyphCacheStats cacheStats = { 0, 0, 0, 0 };
+
   // These are for the metrics for each individual glyph (so we don't need to seek this in file and waste time)
+  // The arrays share one allocation (12 bytes per glyph) owned by gBitmap, or point into the font source
   uint16_t* gUnicode = NULL;  //UTF-16 code, the codes are searched so do not need to be sequential
   uint8_t*  gHeight = NULL;   //cheight
   uint8_t*  gWidth = NULL;    //cwidth
   uint8_t*  gxAdvance = NULL; //setWidth
   int16_t*  gdY = NULL;       //topExtent
   int8_t*   gdX = NULL;       //leftExtent
-  uint32_t* gBitmap = NULL;   //file pointer to greyscale bitmap
-
+  uint32_t* gBitmap = NULL;   //offset of the greyscale bitmap from the start of the font
 
-  fs::File fontFile;
-  fs::FS   &fontFS  = SPIFFS;
+  // Lookup index built by loadMetrics() so getUnicodeIndex() does not scan every glyph
+  static const uint16_t NO_GLYPH = 0xFFFF;
+  uint16_t* gSorted = NULL;     //glyph numbers in ascending Unicode order, NULL if gUnicode is already sorted
+  uint16_t  gAscii[0x7F - 0x20]; //glyph number of printable ASCII characters 0x20-0x7E, NO_GLYPH if absent
 
+  // Scratch space sized by loadMetrics() for the largest glyph so drawGlyph() does not allocate
+  uint16_t* gCell = NULL;     //RGB565 character cell, yAdvance x widest advance
+  uint8_t*  gGrey = NULL;     //greyscale bitmap read from the file
 
 };
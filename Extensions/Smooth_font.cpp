@@ -6,6 +6,9 @@
 // New anti-aliased (smoothed) font functions added below
 ////////////////////////////////////////////////////////////////////////////////////////
 
+TFT_eSPI::blendTable TFT_eSPI::_blendTable[SMOOTH_BLEND_TABLES];
+uint32_t TFT_eSPI::_blendClock = 0;
+
 
 
 /***************************************************************************************
@@ -15,6 +18,8 @@
 // Expects file to be open
 bool TFT_eSPI::drawGlyph(uint16_t code)
 {
+  if (!sf->use()) return false; // Reload if unloaded to make room for another font
+
   if (code < 0x20)
   {
     if (code == '\n') {
@@ -54,68 +59,774 @@ bool TFT_eSPI::drawGlyph(uint16_t code)
     return false;
   }
 
+  // The cell buffer is the font scratch space reserved by loadMetrics()
+  uint16_t* bitmap = sf->gCell;
+  if (!bitmap) return false;
+
   uint16_t bitmapSize = sf->gFont.yAdvance * xAdvance;
-  uint16_t  * bitmap = (uint16_t *) malloc(bitmapSize * 2);
 
   for (uint16_t b = 0; b < bitmapSize; b++) {
     bitmap[b] = bg;
   }
 
-  uint16_t size = sf->gWidth[gNum] * sf->gHeight[gNum];
-  uint8_t* gBuffer = nullptr;
-  
-    sf->fontFile.seek(sf->gBitmap[gNum], fs::SeekSet); // This is taking >30ms for a significant position shift
-    gBuffer =  (uint8_t*)malloc(size);
-    sf->fontFile.read(gBuffer, size);
+  renderGlyph(gNum, xAdvance, bitmap, xAdvance, fg, bg);
 
+  _swapBytes = true;//dosn't work without this
+  pushImage(cursor_x, cursor_y, xAdvance, sf->gFont.yAdvance, bitmap);
 
+  cursor_x += xAdvance;
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           renderGlyph
+** Description:             Blend a glyph into a RGB565 buffer already filled with bg
+*************************************************************************************x*/
+// The glyph is clipped to its cell, xAdvance wide and yAdvance high, at the buffer
+// pointer. Stride is the buffer width in pixels.
+void TFT_eSPI::renderGlyph(uint16_t gNum, uint8_t xAdvance, uint16_t *cell, int32_t stride, uint16_t fg, uint16_t bg)
+{
+  uint8_t bpp;
+  const uint8_t* gBuffer = sf->glyphBitmap(gNum, &bpp);
+  const uint16_t* blend  = blendColours(fg, bg);
 
   uint8_t pixel;
 
   int16_t cy = sf->gFont.maxAscent - sf->gdY[gNum];
   int16_t cx = (sf->gdX[gNum] < 0) ? 0 : sf->gdX[gNum];
 
-  for (int y = 0; y < sf->gHeight[gNum]; y++)
+  // Clip the glyph to the cell, some glyphs extend past xAdvance or the font descent
+  int16_t ys = (cy < 0) ? -cy : 0;
+  int16_t ye = sf->gHeight[gNum];
+  int16_t xe = sf->gWidth[gNum];
+  if (ye + cy > sf->gFont.yAdvance) ye = sf->gFont.yAdvance - cy;
+  if (xe + cx > xAdvance) xe = xAdvance - cx;
+
+  for (int y = ys; y < ye; y++)
   {
-    for (int x = 0; x < sf->gWidth[gNum]; x++)
+    for (int x = 0; x < xe; x++)
     {
-       pixel = gBuffer[x + sf->gWidth[gNum] * y];
+      // 4 and 2 bpp bitmaps are blended straight from the packed pixels
+      if (bpp == 8) pixel = gBuffer[x + sf->gWidth[gNum] * y];
+      else pixel = TFT_eSPI_SmoothFont::glyphAlpha(gBuffer, bpp, x + sf->gWidth[gNum] * y);
 
       if (pixel)
       {
         if (pixel == 0xFF)
         {
-          bitmap[((y +cy) * xAdvance)  +x + cx ] = fg;
+          cell[((y +cy) * stride)  +x + cx ] = fg;
+        }
+        else if (blend)
+        {
+           cell[((y +cy) * stride)  +x + cx ] = blend[pixel >> SMOOTH_BLEND_SHIFT];
         }
         else
         {
-           bitmap[((y +cy) * xAdvance)  +x + cx ] = alphaBlend( pixel, fg, bg);
+           cell[((y +cy) * stride)  +x + cx ] = alphaBlend( pixel, fg, bg);
         }
       }
     }
   }
+}
 
-  _swapBytes = true;//dosn't work without this
-  pushImage(cursor_x, cursor_y, xAdvance, sf->gFont.yAdvance, bitmap);
+/***************************************************************************************
+** Function name:           blendColours
+** Description:             Get the alpha blend table for a colour pair
+*************************************************************************************x*/
+// Tables are kept for the SMOOTH_BLEND_TABLES most recently used colour pairs, the
+// least recently used table is refilled for a new pair
+const uint16_t* TFT_eSPI::blendColours(uint16_t fg, uint16_t bg)
+{
+  if (!_blendTables) return nullptr;
 
-  cursor_x += xAdvance;
-  
-  if (bitmap) {
-    free(bitmap);
+  blendTable* table  = _blendTable;
+  blendTable* oldest = _blendTable;
+
+  for (uint8_t i = 0; i < SMOOTH_BLEND_TABLES; i++, table++)
+  {
+    if (table->lastUse && (table->fg == fg) && (table->bg == bg))
+    {
+      table->lastUse = ++_blendClock;
+      return table->colour;
+    }
+    if (table->lastUse < oldest->lastUse) oldest = table;
+  }
+
+  oldest->fg = fg;
+  oldest->bg = bg;
+  oldest->lastUse = ++_blendClock;
+
+  // Each level is the alpha at the centre of the range it covers, so 0 and 255 are exact
+  for (uint16_t i = 0; i < SMOOTH_BLEND_LEVELS; i++)
+  {
+    oldest->colour[i] = alphaBlend((i * 255 + (SMOOTH_BLEND_LEVELS - 1) / 2) / (SMOOTH_BLEND_LEVELS - 1), fg, bg);
+  }
+
+  return oldest->colour;
+}
+
+/***************************************************************************************
+** Function name:           layoutGlyphs
+** Description:             Find where drawGlyph() would put each glyph of a string
+*************************************************************************************x*/
+// Works along the string from the text cursor until a glyph needs a new line or would
+// not be drawn, the run would be wider than maxWidth pixels or the cell list is full.
+// Returns the number of string bytes used, the cursor is not moved.
+uint16_t TFT_eSPI::layoutGlyphs(const uint8_t *string, uint16_t len, glyphCell *cell, uint16_t *cells, int32_t maxWidth)
+{
+  uint16_t n = 0, count = 0;
+  int32_t  x = cursor_x, xs = 0;
+
+  *cells = 0;
+
+  // drawGlyph() would move the cursor to the top of the print box first
+  if (textwrapY && ((cursor_y + sf->gFont.yAdvance) >= _pBottom)) return 0;
+
+  while ((n < len) && (count < SMOOTH_RUN_GLYPHS))
+  {
+    uint16_t next = n;
+    uint16_t code = decodeUTF8((uint8_t*)string, &next, len - n);
+
+    if ((code == '\n') || (code == '\r') || (code == 0)) break;
+
+    uint16_t gNum = 0;
+    bool found = sf->getUnicodeIndex(code, &gNum);
+    uint8_t xAdvance = (found) ?  sf->gxAdvance[gNum] : sf->gFont.spaceWidth + 4;
+    int16_t right = sf->gWidth[gNum] + sf->gdX[gNum];
+
+    if (textwrapX && (x + right > _pRight)) break;
+
+    int32_t cx = x;
+    if (cx == _pLeft) cx -= sf->gdX[gNum];
+
+    // Leave glyphs that drawGlyph() would refuse to draw to drawGlyph()
+    if (cx + right > _pRight) break;
+
+    if (count == 0) xs = cx;
+    if (cx + xAdvance - xs > maxWidth) break;
+
+    cell[count].x = cx;
+    cell[count].gNum = gNum;
+    cell[count].xAdvance = xAdvance;
+    count++;
+
+    x = cx + xAdvance;
+    n = next;
+  }
+
+  *cells = count;
+  return n;
+}
+
+/***************************************************************************************
+** Function name:           stripBuffer
+** Description:             Get the string strip buffer, grown if needed
+*************************************************************************************x*/
+uint16_t* TFT_eSPI::stripBuffer(uint32_t pixels)
+{
+  if (pixels * 2 > _stripLimit) return nullptr;
+
+  if (pixels * 2 > _stripSize) {
+    uint16_t* strip = (uint16_t*)realloc(_stripBuffer, pixels * 2);
+    if (!strip) return nullptr;
+    _stripBuffer = strip;
+    _stripSize = pixels * 2;
+  }
+  return _stripBuffer;
+}
+
+/***************************************************************************************
+** Function name:           setStringBuffer
+** Description:             Set the RAM limit for rendering strings in one window
+*************************************************************************************x*/
+void TFT_eSPI::setStringBuffer(uint32_t bytes)
+{
+  _stripLimit = bytes;
+
+  if (_stripSize > bytes) {
+    free(_stripBuffer);
+    _stripBuffer = nullptr;
+    _stripSize = 0;
+  }
+}
+
+/***************************************************************************************
+** Function name:           drawStringStrip
+** Description:             Draw a smooth font string, background and padding in one window
+*************************************************************************************x*/
+// Used by drawString(), poX and poY are after datum adjustment. Returns false if the
+// string must be drawn glyph by glyph, e.g. it wraps or the strip is too big.
+// run is the text run cache entry for the string, or nullptr.
+bool TFT_eSPI::drawStringStrip(const char *string, int32_t poX, int32_t poY, int32_t cwidth, uint8_t padding, textRun *run)
+{
+  if (textcolor == textbgcolor) return false;
+
+  // Background and padding areas filled by drawString()
+  int32_t fill[3][2] = { { poX, poX + cwidth }, { 0, 0 }, { 0, 0 } };
+
+  if (padX > cwidth) {
+    int32_t half = (padX - cwidth) >> 1;
+    switch(padding) {
+      case 1:
+        fill[1][0] = poX + cwidth; fill[1][1] = poX + padX;
+        break;
+      case 2: {
+        int32_t padXc = (half > poX) ? poX : half;
+        fill[1][0] = poX + cwidth; fill[1][1] = poX + cwidth + half;
+        fill[2][0] = poX - padXc;  fill[2][1] = poX - padXc + half;
+        break;
+      }
+      case 3: {
+        int32_t padXc = poX + cwidth;
+        if (padXc > padX) padXc = padX;
+        fill[1][0] = poX + cwidth - padXc; fill[1][1] = poX;
+        break;
+      }
+    }
+  }
+
+  int32_t xs = poX, xe = poX + cwidth;
+  for (uint8_t i = 1; i < 3; i++) {
+    if (fill[i][1] <= fill[i][0]) continue;
+    if (fill[i][0] < xs) xs = fill[i][0];
+    if (fill[i][1] > xe) xe = fill[i][1];
+  }
+
+  // Fill extents relative to the string, used to check a cached block matches
+  int32_t fillX[3][2] = { { 0, 0 }, { 0, 0 }, { 0, 0 } };
+  for (uint8_t i = 0; i < 3; i++) {
+    if (fill[i][1] <= fill[i][0]) continue;
+    fillX[i][0] = fill[i][0] - poX;
+    fillX[i][1] = fill[i][1] - poX;
+  }
+
+  bool atLeft = (poX == _pLeft);
+
+  if (run) {
+    // The block can be reused if the string would be laid out the same way here
+    if ((run->atLeft == atLeft) && (poX + run->inkRight <= _pRight) &&
+        !(textwrapY && ((poY + run->h) >= _pBottom)) && !memcmp(run->fill, fillX, sizeof(fillX))) {
+      _swapBytes = true;
+      pushImage(poX + run->xs, poY, run->w, run->h, (uint16_t*)(run + 1));
+      cursor_x = poX + run->cursorX;
+      runCacheStats.hits++;
+      return true;
+    }
+    removeTextRun(run); // Replaced below
+  }
+
+  if (!sf->use() || !sf->gCell) return false;
+
+  uint16_t len = strlen(string);
+  uint16_t cells = 0;
+  glyphCell cell[SMOOTH_RUN_GLYPHS];
+
+  int32_t cursorX = cursor_x, cursorY = cursor_y;
+  cursor_x = poX;
+  cursor_y = poY;
+
+  uint16_t h = sf->gFont.yAdvance;
+  int32_t  maxWidth = _stripLimit / (h * 2);
+
+  if (layoutGlyphs((const uint8_t*)string, len, cell, &cells, maxWidth) < len) {
+    cursor_x = cursorX;
+    cursor_y = cursorY;
+    return false;
+  }
+
+  if (cells) {
+    if (cell[0].x < xs) xs = cell[0].x;
+    if (cell[cells - 1].x + cell[cells - 1].xAdvance > xe) xe = cell[cells - 1].x + cell[cells - 1].xAdvance;
+  }
+
+  int32_t w = xe - xs;
+  uint16_t* strip = (w > 0) ? stripBuffer(w * h) : nullptr;
+
+  if (!strip) {
+    cursor_x = cursorX;
+    cursor_y = cursorY;
+    return false;
+  }
+
+  prefetchRun(cell, cells);
+
+  uint16_t bg = textbgcolor;
+  for (uint32_t i = 0; i < (uint32_t)w * h; i++) strip[i] = bg;
+
+  for (uint16_t i = 0; i < cells; i++) {
+    renderGlyph(cell[i].gNum, cell[i].xAdvance, strip + cell[i].x - xs, w, textcolor, bg);
+  }
+  sf->endPrefetch();
+
+  // Padding is filled after the text, as drawString() does
+  for (uint8_t i = 1; i < 3; i++) {
+    for (int32_t y = 0; y < h; y++) {
+      for (int32_t x = fill[i][0]; x < fill[i][1]; x++) strip[y * w + x - xs] = bg;
+    }
+  }
+
+  _swapBytes = true;
+  pushImage(xs, poY, w, h, strip);
+
+  if (cells) cursor_x = cell[cells - 1].x + cell[cells - 1].xAdvance;
+
+  if (!_runBudget || !cells) return true;
+
+  // Keep the block in the text run cache
+  runCacheStats.misses++;
+
+  uint16_t length = strlen(string) + 1;
+  size_t   need   = sizeof(textRun) + w * h * 2 + length;
+
+  if (need > _runBudget) return true;
+
+  while (_runHead && (runCacheStats.bytes + need > _runBudget)) {
+    textRun* oldest = _runHead;
+    while (oldest->next) oldest = oldest->next;
+    removeTextRun(oldest);
+    runCacheStats.evictions++;
+  }
+
+  run = (textRun*)malloc(need);
+  if (!run) return true;
+
+  // Right edge checked by layoutGlyphs(), the first glyph may have been moved right
+  int32_t inkRight = poX + sf->gWidth[cell[0].gNum] + sf->gdX[cell[0].gNum];
+  for (uint16_t i = 0; i < cells; i++) {
+    int32_t right = cell[i].x + sf->gWidth[cell[i].gNum] + sf->gdX[cell[i].gNum];
+    if (right > inkRight) inkRight = right;
+  }
+
+  run->font     = sf;
+  run->fg       = textcolor;
+  run->bg       = textbgcolor;
+  run->datum    = textdatum;
+  run->padX     = padX;
+  run->cwidth   = cwidth;
+  run->atLeft   = atLeft;
+  memcpy(run->fill, fillX, sizeof(fillX));
+  run->xs       = xs - poX;
+  run->inkRight = inkRight - poX;
+  run->cursorX  = cursor_x - poX;
+  run->w        = w;
+  run->h        = h;
+  run->size     = need;
+
+  uint16_t* pixels = (uint16_t*)(run + 1);
+  memcpy(pixels, strip, w * h * 2);
+  memcpy(pixels + w * h, string, length);
+
+  uint32_t hash = 2166136261UL; // FNV-1a
+  while (*string) hash = (hash ^ (uint8_t)*string++) * 16777619UL;
+  run->hash = hash;
+
+  run->next = _runHead;
+  _runHead  = run;
+  runCacheStats.bytes += need;
+
+  return true;
+}
+
+/***************************************************************************************
+** Function name:           findTextRun
+** Description:             Find a string drawn before in the same font, colours and datum
+*************************************************************************************x*/
+// The entry found is moved to the front of the list but may not be usable at the new
+// position, drawStringStrip() checks that
+TFT_eSPI::textRun* TFT_eSPI::findTextRun(const char *string)
+{
+  if (!_runHead || (textcolor == textbgcolor)) return nullptr;
+
+  uint32_t hash = 2166136261UL; // FNV-1a
+  for (const char* c = string; *c; c++) hash = (hash ^ (uint8_t)*c) * 16777619UL;
+
+  textRun* prev = nullptr;
+  for (textRun* run = _runHead; run; prev = run, run = run->next)
+  {
+    if ((run->hash != hash) || (run->font != sf) || (run->fg != textcolor) || (run->bg != textbgcolor) ||
+        (run->datum != textdatum) || (run->padX != padX)) continue;
+
+    if (strcmp((const char*)((uint16_t*)(run + 1) + run->w * run->h), string)) continue;
+
+    if (prev) {
+      prev->next = run->next;
+      run->next  = _runHead;
+      _runHead   = run;
+    }
+    return run;
   }
-  if (gBuffer) {
-    free(gBuffer);
+
+  return nullptr;
+}
+
+/***************************************************************************************
+** Function name:           removeTextRun
+** Description:             Free a text run cache entry
+*************************************************************************************x*/
+void TFT_eSPI::removeTextRun(textRun *run)
+{
+  textRun** link = &_runHead;
+  while (*link && (*link != run)) link = &(*link)->next;
+  if (!*link) return;
+
+  *link = run->next;
+  runCacheStats.bytes -= run->size;
+  free(run);
+}
+
+/***************************************************************************************
+** Function name:           setTextRunCache
+** Description:             Set the RAM budget for the text run cache
+*************************************************************************************x*/
+void TFT_eSPI::setTextRunCache(size_t bytes)
+{
+  _runBudget = bytes;
+
+  while (_runHead && (runCacheStats.bytes > _runBudget)) {
+    textRun* oldest = _runHead;
+    while (oldest->next) oldest = oldest->next;
+    removeTextRun(oldest);
+    runCacheStats.evictions++;
+  }
+}
+
+/***************************************************************************************
+** Function name:           clearTextRunCache
+** Description:             Free all text run cache entries
+*************************************************************************************x*/
+void TFT_eSPI::clearTextRunCache(void)
+{
+  while (_runHead) removeTextRun(_runHead);
+}
+
+/***************************************************************************************
+** Function name:           drawGlyphRun
+** Description:             Draw glyphs from the cursor position in one window
+*************************************************************************************x*/
+// Used by the print stream. Returns the number of string bytes drawn, 0 if the first
+// glyph must be handled by drawGlyph() (new line, wrap etc)
+uint16_t TFT_eSPI::drawGlyphRun(const uint8_t *string, uint16_t len)
+{
+  if (!sf->use() || !sf->gCell) return 0;
+
+  uint16_t cells = 0;
+  glyphCell cell[SMOOTH_RUN_GLYPHS];
+
+  uint16_t h = sf->gFont.yAdvance;
+  uint16_t used = layoutGlyphs(string, len, cell, &cells, _stripLimit / (h * 2));
+
+  // A single glyph is drawn just as quickly by drawGlyph()
+  if (cells < 2) return 0;
+
+  if (!drawGlyphCells(cell, cells, cursor_y)) return 0;
+
+  cursor_x = cell[cells - 1].x + cell[cells - 1].xAdvance;
+
+  return used;
+}
+
+/***************************************************************************************
+** Function name:           drawGlyphCells
+** Description:             Draw a row of glyph cells in one window
+*************************************************************************************x*/
+// Cells with no glyph (NO_GLYPH) are left as background
+bool TFT_eSPI::drawGlyphCells(const glyphCell *cell, uint16_t cells, int32_t y)
+{
+  uint16_t h  = sf->gFont.yAdvance;
+  int32_t  xs = cell[0].x;
+  int32_t  w  = cell[cells - 1].x + cell[cells - 1].xAdvance - xs;
+  uint16_t* strip = stripBuffer(w * h);
+  if (!strip) return false;
+
+  prefetchRun(cell, cells);
+
+  uint16_t bg = textbgcolor;
+  for (uint32_t i = 0; i < (uint32_t)w * h; i++) strip[i] = bg;
+
+  for (uint16_t i = 0; i < cells; i++) {
+    if (cell[i].gNum == TFT_eSPI_SmoothFont::NO_GLYPH) continue;
+    renderGlyph(cell[i].gNum, cell[i].xAdvance, strip + cell[i].x - xs, w, textcolor, bg);
   }
+  sf->endPrefetch();
+
+  _swapBytes = true;
+  pushImage(xs, y, w, h, strip);
+
   return true;
 }
 
+/***************************************************************************************
+** Function name:           layoutText
+** Description:             Decode a string and break it into lines that fit a width
+*************************************************************************************x*/
+uint16_t TFT_eSPI::layoutText(TFT_eSPI_TextLayout &layout, const String& string, int32_t width)
+{
+  return layoutText(layout, string.c_str(), width);
+}
+
+uint16_t TFT_eSPI::layoutText(TFT_eSPI_TextLayout &layout, const char *string, int32_t width)
+{
+  if (!fontLoaded || !sf->use()) return 0;
+
+  if (width <= 0) width = _pRight - _pLeft;
+
+  // Nothing to do if the string would be laid out the same way
+  if ((layout._font == sf) && (layout._boxWidth == width) && layout._text && !strcmp(layout._text, string)) return layout._lines;
+
+  // A copy of the string then the glyphs, there are no more glyphs than string bytes
+  size_t length = strlen(string);
+  if (length > 0xFFFF) { layout.clear(); return 0; }
+  uint16_t len = length;
+  size_t   at  = (len + 2) & ~1;
+  char*    text = (char*)malloc(at + len * sizeof(TFT_eSPI_TextLayout::glyphPos));
+  if (!text) { layout.clear(); return 0; }
+  memcpy(text, string, len + 1); // string may be the old copy so is copied before clear()
+
+  layout.clear();
+  layout._text     = text;
+  layout._glyph    = (TFT_eSPI_TextLayout::glyphPos*)(text + at);
+  layout._font     = sf;
+  layout._boxWidth = width;
+  layout._yAdvance = sf->gFont.yAdvance;
+
+  TFT_eSPI_TextLayout::glyphPos* glyph = layout._glyph;
+
+  uint16_t n = 0;          // Glyphs placed
+  uint16_t lineFirst = 0;  // First glyph of the line being filled
+  uint16_t spaceStart = 0; // First of the last spaces on the line, the line can end here
+  uint16_t wordStart = 0;  // Glyph after those spaces, the next line can start here
+  bool     wrapped = false;// Line was started by breaking the one above
+  int32_t  x = 0;
+  uint16_t i = 0;
+
+  while (i < len)
+  {
+    uint16_t code = decodeUTF8((uint8_t*)text, &i, len - i);
+
+    if (code == '\n') {
+      addLayoutLine(layout, lineFirst, n);
+      lineFirst = wordStart = n;
+      wrapped = false;
+      continue;
+    }
+    if (code < 0x20) continue;
+
+    // Spaces are not carried onto the start of a line made by breaking a line
+    if ((code == ' ') && wrapped && (n == lineFirst)) continue;
+
+    uint16_t gNum = TFT_eSPI_SmoothFont::NO_GLYPH;
+    bool found = sf->getUnicodeIndex(code, &gNum);
+    uint8_t xAdvance = found ? sf->gxAdvance[gNum] : sf->gFont.spaceWidth + 4;
+    int8_t  dX       = found ? sf->gdX[gNum] : 0;
+    int16_t right    = found ? dX + sf->gWidth[gNum] : xAdvance;
+
+    for (;;)
+    {
+      // As drawGlyph(), the first glyph on a line is moved so it starts at the left edge
+      int32_t gx = (n == lineFirst) ? -dX : x;
+
+      if ((code == ' ') || (n == lineFirst) || (gx + right <= width)) {
+        glyph[n].code = code;
+        glyph[n].gNum = gNum;
+        glyph[n].x = gx;
+        glyph[n].xAdvance = xAdvance;
+        x = gx + xAdvance;
+        break;
+      }
+
+      // Too wide, break at the last space if there is one, otherwise before this glyph
+      wrapped = true;
+      if ((spaceStart > lineFirst) && (wordStart > spaceStart)) {
+        addLayoutLine(layout, lineFirst, spaceStart);
+        lineFirst = wordStart;
+
+        // Move the start of the word to the new line
+        for (uint16_t j = lineFirst; j < n; j++) {
+          int16_t gdX = (glyph[j].gNum == TFT_eSPI_SmoothFont::NO_GLYPH) ? 0 : sf->gdX[glyph[j].gNum];
+          glyph[j].x = (j == lineFirst) ? -gdX : x;
+          x = glyph[j].x + glyph[j].xAdvance;
+        }
+      }
+      else {
+        addLayoutLine(layout, lineFirst, n);
+        lineFirst = n;
+      }
+      spaceStart = wordStart = lineFirst;
+    }
+
+    if (code == ' ') {
+      if ((n == lineFirst) || (glyph[n - 1].code != ' ')) spaceStart = n;
+      wordStart = n + 1;
+    }
+
+    n++;
+  }
+
+  if (n > lineFirst) addLayoutLine(layout, lineFirst, n);
+
+  layout._glyphs = n;
+  return layout._lines;
+}
+
+/***************************************************************************************
+** Function name:           addLayoutLine
+** Description:             Add a line of glyphs to a text layout
+*************************************************************************************x*/
+void TFT_eSPI::addLayoutLine(TFT_eSPI_TextLayout &layout, uint16_t first, uint16_t end)
+{
+  if (layout._lines == layout._lineSpace) {
+    TFT_eSPI_TextLayout::textLine* line = (TFT_eSPI_TextLayout::textLine*)realloc(layout._line, (layout._lineSpace + 8) * sizeof(TFT_eSPI_TextLayout::textLine));
+    if (!line) return;
+    layout._line = line;
+    layout._lineSpace += 8;
+  }
+
+  // Width to the right of the last glyph, as textWidth()
+  int16_t width = 0;
+  for (uint16_t i = first; i < end; i++) {
+    TFT_eSPI_TextLayout::glyphPos* g = layout._glyph + i;
+    int16_t right = g->x + g->xAdvance;
+    if ((i == end - 1) && (g->gNum != TFT_eSPI_SmoothFont::NO_GLYPH) && (g->code != ' ')) right = g->x + sf->gdX[g->gNum] + sf->gWidth[g->gNum];
+    if (right > width) width = right;
+  }
+
+  TFT_eSPI_TextLayout::textLine* line = layout._line + layout._lines++;
+  line->first = first;
+  line->count = end - first;
+  line->width = width;
+
+  if (width > layout._width) layout._width = width;
+}
+
+/***************************************************************************************
+** Function name:           drawLayout
+** Description:             Draw text laid out by layoutText()
+*************************************************************************************x*/
+void TFT_eSPI::drawLayout(TFT_eSPI_TextLayout &layout, int32_t x, int32_t y)
+{
+  if (!fontLoaded || !layout._text) return;
+
+  // The glyphs must be laid out again if the font has been changed
+  if (layout._font != sf) layoutText(layout, layout._text, layout._boxWidth);
+
+  if (!sf->use() || !sf->gCell) return;
+
+  // Lines are already broken so drawGlyph() must not wrap them
+  bool wrapX = textwrapX, wrapY = textwrapY;
+  textwrapX = textwrapY = false;
+
+  uint16_t  h = sf->gFont.yAdvance;
+  int32_t   maxWidth = _stripLimit / (h * 2);
+  glyphCell cell[SMOOTH_RUN_GLYPHS];
+
+  for (uint16_t l = 0; l < layout._lines; l++)
+  {
+    TFT_eSPI_TextLayout::glyphPos* glyph = layout._glyph + layout._line[l].first;
+    uint16_t count = layout._line[l].count;
+    int32_t  ly    = y + l * h;
+
+    while (count)
+    {
+      // As many glyphs as fit in the strip buffer
+      uint16_t cells = 0;
+      while ((cells < count) && (cells < SMOOTH_RUN_GLYPHS)) {
+        if (cells && (glyph[cells].x + glyph[cells].xAdvance - glyph[0].x > maxWidth)) break;
+        cell[cells].x = x + glyph[cells].x;
+        cell[cells].gNum = glyph[cells].gNum;
+        cell[cells].xAdvance = glyph[cells].xAdvance;
+        cells++;
+      }
+
+      if (!drawGlyphCells(cell, cells, ly)) {
+        // One at a time, the cursor is set so drawGlyph() draws where it was laid out.
+        // Cells with no glyph are left as background as drawGlyphCells() does.
+        for (uint16_t i = 0; i < cells; i++) {
+          if (cell[i].gNum == TFT_eSPI_SmoothFont::NO_GLYPH) {
+            fillRect(cell[i].x, ly, cell[i].xAdvance, h, textbgcolor);
+            continue;
+          }
+          cursor_x = cell[i].x;
+          cursor_y = ly;
+          drawGlyph(glyph[i].code);
+        }
+      }
+
+      glyph += cells;
+      count -= cells;
+    }
+
+    cursor_x = x + layout._line[l].width;
+    cursor_y = ly;
+  }
+
+  textwrapX = wrapX;
+  textwrapY = wrapY;
+}
+
+/***************************************************************************************
+** Function name:           prefetchRun
+** Description:             Read the glyphs of a run in font order before drawing them
+*************************************************************************************x*/
+void TFT_eSPI::prefetchRun(const glyphCell *cell, uint16_t cells)
+{
+  uint16_t glyph[SMOOTH_RUN_GLYPHS];
+  uint16_t count = 0;
+
+  for (uint16_t i = 0; i < cells; i++) {
+    if (cell[i].gNum != TFT_eSPI_SmoothFont::NO_GLYPH) glyph[count++] = cell[i].gNum;
+  }
+
+  sf->prefetchGlyphs(glyph, count);
+}
+
+/***************************************************************************************
+** Function name:           prefetchString
+** Description:             Read the glyphs of a UTF-8 string in font order before drawing them
+*************************************************************************************x*/
+// Only the first SMOOTH_RUN_GLYPHS characters are read ahead, the rest are read when drawn
+void TFT_eSPI::prefetchString(const char *string)
+{
+  if (!sf->use()) return;
+
+  uint16_t glyph[SMOOTH_RUN_GLYPHS];
+  uint16_t count = 0;
+  uint16_t len = strlen(string);
+  uint16_t n = 0;
+
+  while ((n < len) && (count < SMOOTH_RUN_GLYPHS)) {
+    uint16_t uniCode = decodeUTF8((uint8_t*)string, &n, len - n);
+    if (sf->getUnicodeIndex(uniCode, &glyph[count])) count++;
+  }
+
+  sf->prefetchGlyphs(glyph, count);
+}
+
+/***************************************************************************************
+** Function name:           preloadGlyphs
+** Description:             Read the glyphs of a UTF-8 string into the font glyph cache
+*************************************************************************************x*/
+void TFT_eSPI::preloadGlyphs(const char *string)
+{
+  if( !fontLoaded || sf == nullptr || !sf->use()) return;
+
+  uint16_t len = strlen(string);
+  uint16_t n = 0;
+
+  while (n < len) {
+    uint16_t uniCode = decodeUTF8((uint8_t*)string, &n, len - n);
+    uint16_t gNum = 0;
+    if (sf->getUnicodeIndex(uniCode, &gNum)) sf->cachedGlyph(gNum);
+  }
+}
+
 /***************************************************************************************
 ** Function name:           showFont
 ** Description:             Page through all characters in font, td ms between screens
 *************************************************************************************x*/
 void TFT_eSPI::showFont(uint32_t td)
 {
-  if( !fontLoaded || sf == nullptr) return;
+  if( !fontLoaded || sf == nullptr || !sf->use()) return;
 
   int16_t cursorX = width(); // Force start of new page to initialise cursor
   int16_t cursorY = height();// for the first character
@@ -4,6 +4,77 @@ protected:
   TFT_eSPI_SmoothFont * sf = nullptr;
   bool     fontLoaded = false; // Flags when a anti-aliased font is loaded
 
+  // Position of a glyph cell in a run of glyphs drawn in one window
+  typedef struct
+  {
+    int32_t  x;                // Left edge of the cell
+    uint16_t gNum;             // Glyph number in the font
+    uint8_t  xAdvance;         // Cell width
+  } glyphCell;
+
+  #define SMOOTH_RUN_GLYPHS 64 // Maximum glyphs in a run
+
+  uint16_t* _stripBuffer = nullptr;           // String strip buffer, RGB565
+  uint32_t  _stripSize   = 0;                 // Bytes allocated to _stripBuffer
+  uint32_t  _stripLimit  = SMOOTH_STRIP_BYTES;// Maximum bytes for _stripBuffer
+
+  // Text colours blended for each alpha level, shared by all instances
+  typedef struct
+  {
+    uint16_t fg;
+    uint16_t bg;
+    uint32_t lastUse;          // _blendClock when last used, 0 = table empty
+    uint16_t colour[SMOOTH_BLEND_LEVELS];
+  } blendTable;
+
+  static blendTable _blendTable[SMOOTH_BLEND_TABLES];
+  static uint32_t   _blendClock;
+  bool      _blendTables = true; // Use blend tables, see setAttribute(BLEND_TABLES, x)
+
+           // Get the blend table for a colour pair, NULL if disabled. Index with alpha >> SMOOTH_BLEND_SHIFT
+  const uint16_t* blendColours(uint16_t fg, uint16_t bg);
+
+  void      renderGlyph(uint16_t gNum, uint8_t xAdvance, uint16_t *cell, int32_t stride, uint16_t fg, uint16_t bg);
+  uint16_t  layoutGlyphs(const uint8_t *string, uint16_t len, glyphCell *cell, uint16_t *cells, int32_t maxWidth);
+  uint16_t* stripBuffer(uint32_t pixels);
+  void      prefetchRun(const glyphCell *cell, uint16_t cells); // Read the run glyphs in font order
+  void      prefetchString(const char *string);                 // Read the string glyphs in font order
+
+  // Rendered drawString() block kept by the text run cache, the RGB565 pixels
+  // and then the zero terminated string follow the entry in the same allocation
+  typedef struct textRun
+  {
+    textRun* next;             // Most recently used first
+    TFT_eSPI_SmoothFont* font;
+    uint32_t hash;             // Of the string
+    uint16_t fg;
+    uint16_t bg;
+    uint8_t  datum;
+    bool     atLeft;           // String started at the left edge of the viewport/print box
+    int32_t  padX;
+    uint16_t cwidth;           // String width, as textWidth()
+    int32_t  fill[3][2];       // Background and padding extents, relative to the string x
+    int32_t  xs;               // Block left edge, relative to the string x
+    int32_t  inkRight;         // Right edge checked against the viewport, relative to the string x
+    int32_t  cursorX;          // Text cursor after the string, relative to the string x
+    uint16_t w;                // Block size in pixels
+    uint16_t h;
+    size_t   size;             // Bytes allocated
+  } textRun;
+
+  textRun*  _runHead   = nullptr;
+  size_t    _runBudget = 0;    // Text run cache RAM limit in bytes, 0 = disabled
+
+  textRun*  findTextRun(const char *string);
+  void      removeTextRun(textRun *run);
+
+           // Used by drawString() and print(), the Sprite class draws glyph by glyph
+  virtual bool     drawStringStrip(const char *string, int32_t poX, int32_t poY, int32_t cwidth, uint8_t padding, textRun *run);
+  virtual uint16_t drawGlyphRun(const uint8_t *string, uint16_t len);
+           // Draw glyph cells in one window at y, returns false if they must be drawn glyph by glyph
+  virtual bool     drawGlyphCells(const glyphCell *cell, uint16_t cells, int32_t y);
+  void      addLayoutLine(TFT_eSPI_TextLayout &layout, uint16_t first, uint16_t end);
+
 
 
 public:
@@ -19,6 +90,42 @@ public:
 
   virtual bool drawGlyph(uint16_t code);
 
+           // Set the RAM limit for drawing a smooth font string and its background/padding
+           // in one TFT window. The buffer is kept and grown up to this size, default is
+           // SMOOTH_STRIP_BYTES. Longer strings are drawn glyph by glyph, 0 frees the buffer.
+  void     setStringBuffer(uint32_t bytes);
+
+           // Text run cache, keeps the pixels of strings drawn by drawString() so that drawing the
+           // same string, font, colours, datum and padding again is a single pushImage().
+           // The least recently drawn strings are discarded to keep within the byte budget.
+  void     setTextRunCache(size_t bytes);  // Set the RAM budget, 0 (default) disables the cache
+  void     clearTextRunCache(void);        // Discard all cached strings, budget is not changed
+
+  // Text run cache statistics
+  typedef struct
+  {
+    uint32_t hits;                   // Strings pushed from the cache
+    uint32_t misses;                 // Strings rendered while the cache is enabled
+    uint32_t evictions;              // Strings discarded to make space
+    size_t   bytes;                  // RAM in use by the cache, including entry overhead
+  } textRunStats;
+
+  textRunStats runCacheStats = { 0, 0, 0, 0 };
+
+           // Lay out a UTF-8 string in the current font, lines are broken between words to fit
+           // width pixels (0 = print box width) and at new lines. The string is only decoded
+           // again if the string, font or width has changed. Returns the number of lines.
+  uint16_t layoutText(TFT_eSPI_TextLayout &layout, const char *string, int32_t width = 0);
+  uint16_t layoutText(TFT_eSPI_TextLayout &layout, const String& string, int32_t width = 0);
+           // Draw laid out text with the top left of the first line at x,y (default print box
+           // top left). The text colours are used, the background of each line is filled.
+  void     drawLayout(TFT_eSPI_TextLayout &layout, int32_t x, int32_t y);
+  void     drawLayout(TFT_eSPI_TextLayout &layout) {drawLayout(layout, _pLeft, _pTop);};
+
+           // Warm up the glyph cache of the selected font (see setGlyphCache()) with
+           // the characters in a UTF-8 string, e.g. "0123456789.-V"
+  void     preloadGlyphs(const char *string);
+
   void     showFont(uint32_t td);
 
 
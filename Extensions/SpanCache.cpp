@@ -0,0 +1,143 @@
+/***************************************************************************************
+// Span cache, see SpanCache.h
+***************************************************************************************/
+
+TFT_eSPI::spanShape* TFT_eSPI::_spanList  = NULL;
+TFT_eSPI::spanShape* TFT_eSPI::_spanRec   = NULL;
+uint32_t             TFT_eSPI::_spanUsed  = 0;
+uint32_t             TFT_eSPI::_spanLimit = SPAN_CACHE_BYTES;
+
+/***************************************************************************************
+** Function name:           setSpanCache
+** Description:             Set the cache memory cap, freeing shapes to fit
+*************************************************************************************x*/
+void TFT_eSPI::setSpanCache(uint32_t bytes)
+{
+  _spanLimit = bytes;
+  freeSpans(bytes);
+}
+
+
+/***************************************************************************************
+** Function name:           freeSpans
+** Description:             Free the least recently used shapes until within bytes
+*************************************************************************************x*/
+void TFT_eSPI::freeSpans(uint32_t bytes)
+{
+  while (_spanUsed > bytes) {
+    // The least recently used shape is at the end of the list
+    spanShape** last = &_spanList;
+    while ((*last)->next) last = &(*last)->next;
+    _spanUsed -= (*last)->bytes;
+    free(*last);
+    *last = NULL;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           recordSpan
+** Description:             Add a span drawn by a shape to the shape being recorded
+*************************************************************************************x*/
+void TFT_eSPI::recordSpan(int32_t x, int32_t y, int32_t w)
+{
+  spanShape* s = _spanRec;
+  if (!s->rows || (w < 1)) return;
+
+  uint16_t row = abs(y) - (s->kind == SPAN_CORNERS);
+  if (row >= s->rows) { s->rows = 0; return; }
+
+  int16_t* span = (int16_t*)(s + 1) + row * 2;
+  int32_t  xe   = x + w - 1;
+
+  // A row is kept as one span, so spans drawn on the same row must overlap or touch
+  if (span[0] <= span[1]) {
+    if ((x > span[1] + 1) || (xe < span[0] - 1)) { s->rows = 0; return; }
+    if (x  < span[0]) span[0] = x;
+    if (xe > span[1]) span[1] = xe;
+  }
+  else {
+    span[0] = x;
+    span[1] = xe;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           drawCachedSpans
+** Description:             Draw a shape from the cache, returns false if not cached
+*************************************************************************************x*/
+bool TFT_eSPI::drawCachedSpans(uint8_t kind, int32_t x, int32_t y, int32_t a, int32_t b, uint32_t color,
+                               uint8_t corners, int32_t delta)
+{
+  if (_spanRec || !_spanLimit || (a < 1) || (a > 0x7FFF) || (b > 0x7FFF)) return false;
+
+  // Find the shape and move it to the front of the list
+  spanShape** link = &_spanList;
+  while (*link && (((*link)->kind != kind) || ((*link)->a != a) || ((*link)->b != b))) link = &(*link)->next;
+
+  spanShape* s = *link;
+  if (s) *link = s->next;
+  else {
+    // Record the shape by drawing it at 0,0 with the spans going to the cache
+    uint16_t rows  = (kind == SPAN_ELLIPSE) ? b + 1 : a + (kind != SPAN_CORNERS);
+    uint32_t bytes = sizeof(spanShape) + rows * 2 * sizeof(int16_t);
+    if (bytes > _spanLimit) return false;
+
+    freeSpans(_spanLimit - bytes);
+
+    s = (spanShape*)malloc(bytes);
+    if (!s) return false;
+
+    s->kind  = kind;
+    s->a     = a;
+    s->b     = b;
+    s->rows  = rows;
+    s->bytes = bytes;
+
+    int16_t* span = (int16_t*)(s + 1);
+    for (uint16_t i = 0; i < rows; i++) { span[i * 2] = 0; span[i * 2 + 1] = -1; }
+
+    _spanRec = s;
+    if (kind == SPAN_CIRCLE)  fillCircle(0, 0, a, color);
+    if (kind == SPAN_CORNERS) fillCircleHelper(0, 0, a, 3, 0, color);
+    if (kind == SPAN_ELLIPSE) fillEllipse(0, 0, a, b, color);
+    _spanRec = NULL;
+
+    // Every row must have a span, otherwise keep the shape so it is not recorded again
+    for (uint16_t i = 0; i < s->rows; i++) if (span[i * 2] > span[i * 2 + 1]) s->rows = 0;
+
+    _spanUsed += bytes;
+  }
+
+  s->next = _spanList;
+  _spanList = s;
+
+  if (!s->rows) return false;
+
+  int16_t* span  = (int16_t*)(s + 1);
+  uint16_t first = (kind == SPAN_CORNERS);
+
+  // Keep the caller's transaction open, e.g. fillRoundRect()
+  bool wasInTransaction = inTransaction;
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  // Top to bottom, the rows above the centre are the same as those below
+  if (corners & 2) {
+    for (int32_t i = s->rows - 1; i >= 0; i--) {
+      drawFastHLine(x + span[i * 2], y - i - first, span[i * 2 + 1] - span[i * 2] + 1 + delta, color);
+    }
+  }
+
+  if (corners & 1) {
+    for (int32_t i = first ? 0 : 1; i < s->rows; i++) {
+      drawFastHLine(x + span[i * 2], y + i + first, span[i * 2 + 1] - span[i * 2] + 1 + delta, color);
+    }
+  }
+
+  inTransaction = wasInTransaction;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+
+  return true;
+}
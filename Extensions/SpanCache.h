@@ -0,0 +1,48 @@
+/***************************************************************************************
+// Span cache, part of the TFT_eSPI class. The scanline spans of fillCircle(), fillEllipse()
+// and the corners of fillRoundRect() are kept for each radius, so drawing the same shape
+// again replays them in one transaction instead of working them out again. Spans are kept
+// relative to the centre, so one cache serves the TFT and all sprites, least recently
+// used shapes are freed to stay within the memory cap.
+***************************************************************************************/
+
+// Default memory cap for the cache, 0 to leave it off until setSpanCache() is called
+#ifndef SPAN_CACHE_BYTES
+  #define SPAN_CACHE_BYTES 0
+#endif
+
+// Kinds of cached shape
+#define SPAN_CIRCLE  0
+#define SPAN_CORNERS 1                   // fillCircleHelper(), the corners of fillRoundRect()
+#define SPAN_ELLIPSE 2
+
+ public:
+           // Set the memory cap in bytes, shapes are freed to fit and 0 turns the cache off.
+           // A circle of radius r takes about 4 * r + 16 bytes.
+  static void     setSpanCache(uint32_t bytes);
+  static uint32_t spanCacheUsed(void) {return _spanUsed;}; // Bytes used by cached shapes
+
+ private:
+  // Spans of a cached shape for each row from the centre row down, the rows above are the same
+  typedef struct spanShape
+  {
+    struct spanShape* next;              // Next less recently used shape
+    uint8_t  kind;                       // SPAN_CIRCLE, SPAN_CORNERS or SPAN_ELLIPSE
+    int16_t  a, b;                       // Radius, or the x and y radius of an ellipse
+    uint16_t rows;                       // Rows held, 0 if the shape cannot be cached
+    uint32_t bytes;                      // Memory used by the shape
+  } spanShape;                           // followed by the start and end x of each row
+
+  static spanShape* _spanList;           // Cached shapes, most recently used first
+  static spanShape* _spanRec;            // Shape being recorded, NULL when drawing
+  static uint32_t   _spanUsed;           // Bytes used by cached shapes
+  static uint32_t   _spanLimit;          // Memory cap
+
+  static void freeSpans(uint32_t bytes);  // Free shapes until no more than bytes are used
+  bool     drawCachedSpans(uint8_t kind, int32_t x, int32_t y, int32_t a, int32_t b, uint32_t color,
+                           uint8_t corners = 3, int32_t delta = 0);
+  void     recordSpan(int32_t x, int32_t y, int32_t w);
+
+           // Shapes draw their spans with this so they can be recorded
+  void     shapeSpan(int32_t x, int32_t y, int32_t w, uint32_t color)
+           { if (_spanRec) recordSpan(x, y, w); else drawFastHLine(x, y, w, color); };
@@ -71,6 +71,10 @@ void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames)
   _sh = h;
   _scolor = TFT_BLACK;
 
+  // The whole Sprite needs pushing
+  _dirtyCount = 0;
+  if (_dirtyTracking) markDirty(0, 0, w, h);
+
   _xpivot = w/2;
   _ypivot = h/2;
 
@@ -118,35 +122,23 @@ void* TFT_eSprite::callocSprite(int16_t w, int16_t h, uint8_t frames)
   // Add one extra "off screen" pixel to point out-of-bounds setWindow() coordinates
   // this means push/writeColor functions do not need additional bounds checks and
   // hence will run faster in normal circumstances.
-  uint8_t* ptr8 = NULL;
+  uint32_t bytes;
 
   if (_bpp == 16)
   {
-#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
-    if ( psramFound() && this->_psram_enable ) ptr8 = ( uint8_t*) ps_calloc(w * h + 1, sizeof(uint16_t));
-    else
-#endif
-    ptr8 = ( uint8_t*) calloc(w * h + 1, sizeof(uint16_t));
+    bytes = (w * h + 1) * sizeof(uint16_t);
   }
 
   else if (_bpp == 8)
   {
-#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
-    if ( psramFound() && this->_psram_enable ) ptr8 = ( uint8_t*) ps_calloc(w * h + 1, sizeof(uint8_t));
-    else
-#endif
-    ptr8 = ( uint8_t*) calloc(w * h + 1, sizeof(uint8_t));
+    bytes = w * h + 1;
   }
 
   else if (_bpp == 4)
   {
     w = (w+1) & 0xFFFE; // width needs to be multiple of 2, with an extra "off screen" pixel
     _iwidth = w;
-#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
-    if ( psramFound() && this->_psram_enable ) ptr8 = ( uint8_t*) ps_calloc(((w * h) >> 1) + 1, sizeof(uint8_t));
-    else
-#endif
-    ptr8 = ( uint8_t*) calloc(((w * h) >> 1) + 1, sizeof(uint8_t));
+    bytes = ((w * h) >> 1) + 1;
   }
 
   else // Must be 1 bpp
@@ -161,12 +153,19 @@ void* TFT_eSprite::callocSprite(int16_t w, int16_t h, uint8_t frames)
 
     if (frames > 2) frames = 2; // Currently restricted to 2 frame buffers
     if (frames < 1) frames = 1;
+    bytes = frames * (w>>3) * h + frames;
+  }
+
+  // Use the Sprite memory pool if selected, or the heap if the Sprite does not fit
+  uint8_t* ptr8 = NULL;
+  if (_spritePool) ptr8 = (uint8_t*) poolCalloc(bytes);
+  if (ptr8) return ptr8;
+
 #if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
-    if ( psramFound() && this->_psram_enable ) ptr8 = ( uint8_t*) ps_calloc(frames * (w>>3) * h + frames, sizeof(uint8_t));
-    else
+  if ( psramFound() && this->_psram_enable ) ptr8 = ( uint8_t*) ps_calloc(bytes, sizeof(uint8_t));
+  else
 #endif
-    ptr8 = ( uint8_t*) calloc(frames * (w>>3) * h + frames, sizeof(uint8_t));
-  }
+  ptr8 = ( uint8_t*) calloc(bytes, sizeof(uint8_t));
 
   return ptr8;
 }
@@ -196,6 +195,8 @@ void TFT_eSprite::createPalette(uint16_t colorMap[], int colors)
   {
     _colorMap[i] = colorMap[i];
   }
+
+  if (_dirtyTracking) markDirty(0, 0, _iwidth, _iheight);
 }
 
 /***************************************************************************************
@@ -223,6 +224,8 @@ void TFT_eSprite::createPalette(const uint16_t colorMap[], int colors)
   {
     _colorMap[i] = pgm_read_word(colorMap++);
   }
+
+  if (_dirtyTracking) markDirty(0, 0, _iwidth, _iheight);
 }
 
 /***************************************************************************************
@@ -254,7 +257,7 @@ void* TFT_eSprite::frameBuffer(int8_t f)
 void* TFT_eSprite::setColorDepth(int8_t b)
 {
   // Can't change an existing sprite's colour depth so delete it
-  if (_created) free(_img8_1);
+  if (_created && !poolFree(_img8_1)) free(_img8_1);
 
   // Now define the new colour depth
   if ( b > 8 ) _bpp = 16;  // Bytes per pixel
@@ -305,6 +308,8 @@ void TFT_eSprite::setPaletteColor(uint8_t index, uint16_t color)
   if (_colorMap == nullptr || index > 15)
     return; // out of bounds
   _colorMap[index] = color;
+
+  if (_dirtyTracking) markDirty(0, 0, _iwidth, _iheight);
 }
 
 /***************************************************************************************
@@ -332,7 +337,7 @@ void TFT_eSprite::deleteSprite(void)
     free(_colorMap);
   }
 
-  free(_img8_1);
+  if (!poolFree(_img8_1)) free(_img8_1);
 
   _created = false;
 }
@@ -677,6 +682,232 @@ void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transp)
 }
 
 
+/***************************************************************************************
+** Function name:           setDirtyTracking
+** Description:             Start or stop recording the areas drawn for pushDirty()
+*************************************************************************************x*/
+void TFT_eSprite::setDirtyTracking(bool enable)
+{
+  _dirtyTracking = enable;
+  _dirtyCount = 0;
+
+  // The TFT may not match the Sprite yet, so start with all of it
+  if (enable && _created) markDirty(0, 0, _iwidth, _iheight);
+}
+
+
+/***************************************************************************************
+** Function name:           markDirty
+** Description:             Add an area to the dirty rectangles pushed by pushDirty()
+*************************************************************************************x*/
+void TFT_eSprite::markDirty(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if ((x + w) > _iwidth)  w = _iwidth  - x;
+  if ((y + h) > _iheight) h = _iheight - y;
+  if ((w < 1) || (h < 1)) return;
+
+  int32_t xe = x + w, ye = y + h;
+
+  for (uint8_t i = 0; i < _dirtyCount; )
+  {
+    dirtyRect &r = _dirty[i];
+    int32_t rxe = r.x + r.w, rye = r.y + r.h;
+
+    // Rectangles that overlap or touch are merged
+    if ((x <= rxe) && (r.x <= xe) && (y <= rye) && (r.y <= ye))
+    {
+      if ((x >= r.x) && (y >= r.y) && (xe <= rxe) && (ye <= rye)) return; // Already dirty
+
+      x  = min(x, (int32_t)r.x);  y  = min(y, (int32_t)r.y);
+      xe = max(xe, rxe);          ye = max(ye, rye);
+
+      // Remove it and check the rest again as the area is now larger
+      r = _dirty[--_dirtyCount];
+      i = 0;
+      continue;
+    }
+
+    i++;
+
+    // If the list is full merge with the rectangle that adds the least area
+    if ((i == _dirtyCount) && (_dirtyCount == SPRITE_DIRTY_RECTS))
+    {
+      uint8_t  best = 0;
+      uint32_t bestArea = 0xFFFFFFFF;
+      for (uint8_t k = 0; k < _dirtyCount; k++)
+      {
+        dirtyRect &m = _dirty[k];
+        uint32_t area = (max(xe, (int32_t)(m.x + m.w)) - min(x, (int32_t)m.x)) *
+                        (max(ye, (int32_t)(m.y + m.h)) - min(y, (int32_t)m.y)) - m.w * m.h;
+        if (area < bestArea) { bestArea = area; best = k; }
+      }
+
+      dirtyRect &m = _dirty[best];
+      x  = min(x, (int32_t)m.x);         y  = min(y, (int32_t)m.y);
+      xe = max(xe, (int32_t)(m.x + m.w)); ye = max(ye, (int32_t)(m.y + m.h));
+
+      m = _dirty[--_dirtyCount];
+      i = 0;
+    }
+  }
+
+  dirtyRect &r = _dirty[_dirtyCount++];
+  r.x = x; r.y = y;
+  r.w = xe - x; r.h = ye - y;
+}
+
+
+/***************************************************************************************
+** Function name:           pushDirty
+** Description:             Push the areas drawn since the last pushDirty() to the TFT
+*************************************************************************************x*/
+void TFT_eSprite::pushDirty(int32_t x, int32_t y)
+{
+  if (!_created || !_dirtyCount) return;
+
+  // 1 bpp pixels are packed in bytes and may be rotated so the whole Sprite is pushed
+  if (_bpp == 1) { pushSprite(x, y); _dirtyCount = 0; return; }
+
+  if ((_bpp == 4) && (_colorMap == nullptr)) return;
+
+  // 16 bpp Sprite pixels are stored ready to send
+  bool oldSwapBytes = _tft->getSwapBytes();
+  if (_bpp == 16) _tft->setSwapBytes(false);
+  _tft->startWrite();
+
+  for (uint8_t i = 0; i < _dirtyCount; i++)
+  {
+    int32_t rx = _dirty[i].x, ry = _dirty[i].y;
+    int32_t rw = _dirty[i].w, rh = _dirty[i].h;
+
+    if (_bpp == 16)
+    {
+      // Clip to the TFT and push the rectangle in one window
+      int32_t tx = x + rx, ty = y + ry;
+      if (tx < 0) { rw += tx; rx -= tx; tx = 0; }
+      if (ty < 0) { rh += ty; ry -= ty; ty = 0; }
+      if ((tx + rw) > _tft->width())  rw = _tft->width()  - tx;
+      if ((ty + rh) > _tft->height()) rh = _tft->height() - ty;
+      if ((rw < 1) || (rh < 1)) continue;
+
+      _tft->setWindow(tx, ty, tx + rw - 1, ty + rh - 1);
+
+      uint16_t* ptr = _img + rx + ry * _iwidth;
+      if (rw == _iwidth) _tft->pushPixels(ptr, rw * rh);
+      else while (rh--) { _tft->pushPixels(ptr, rw); ptr += _iwidth; }
+    }
+    else if (_bpp == 8)
+    {
+      for (int32_t yp = ry; yp < ry + rh; yp++)
+        _tft->pushImage(x + rx, y + yp, rw, 1, _img8 + rx + yp * _iwidth, true);
+    }
+    else
+    {
+      // Start on a byte boundary, 2 pixels per byte
+      rw += rx & 1; rx &= ~1;
+      for (int32_t yp = ry; yp < ry + rh; yp++)
+        _tft->pushImage(x + rx, y + yp, rw, 1, _img4 + ((rx + yp * _iwidth) >> 1), false, _colorMap);
+    }
+  }
+
+  _tft->endWrite();
+  _tft->setSwapBytes(oldSwapBytes);
+
+  _dirtyCount = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           composeLine
+** Description:             Merge part of a Sprite row into a line of byte swapped colours
+*************************************************************************************x*/
+void TFT_eSprite::composeLine(uint16_t* line, int32_t x, int32_t w, int32_t y, uint32_t transp, const uint16_t* palette)
+{
+  if (!_created) return;
+
+  // Clip to the Sprite, 1 bpp Sprites may be rotated
+  int32_t sw = (_bpp == 1) ? width()  : _dwidth;
+  int32_t sh = (_bpp == 1) ? height() : _dheight;
+
+  if ((y < 0) || (y >= sh)) return;
+  if (x < 0) { w += x; line -= x; x = 0; }
+  if ((x + w) > sw) w = sw - x;
+  if (w < 1) return;
+
+  bool opaque = transp > 0xFFFF;
+
+  if (_bpp == 16)
+  {
+    // Sprite pixels are stored byte swapped
+    uint16_t  key = (transp >> 8) | (transp << 8);
+    uint16_t* ptr = _img + x + y * _iwidth;
+
+    if (opaque) memcpy(line, ptr, w << 1);
+    else while (w--)
+    {
+      if (*ptr != key) *line = *ptr;
+      ptr++; line++;
+    }
+  }
+  else if (_bpp == 8)
+  {
+    uint8_t  key = (transp & 0xE000)>>8 | (transp & 0x0700)>>6 | (transp & 0x0018)>>3;
+    uint8_t* ptr = _img8 + x + y * _iwidth;
+    uint8_t  blue[] = {0, 11, 21, 31};
+
+    while (w--)
+    {
+      uint8_t c = *ptr++;
+      if (opaque || (c != key))
+      {
+        uint16_t color = (c & 0xE0)<<8 | (c & 0xC0)<<5 | (c & 0x1C)<<6 | (c & 0x1C)<<3 | blue[c & 0x03];
+        *line = (color >> 8) | (color << 8);
+      }
+      line++;
+    }
+  }
+  else if (_bpp == 4)
+  {
+    if (palette == nullptr) palette = _colorMap;
+    if (palette == nullptr) return;
+
+    uint8_t  key = transp & 0x0F;
+    uint8_t* ptr = _img4 + ((x + y * _iwidth) >> 1);
+
+    while (w--)
+    {
+      // even index = bits 7 .. 4, odd index = bits 3 .. 0
+      uint8_t c = (x++ & 0x01) ? (*ptr++ & 0x0F) : (*ptr >> 4);
+      if (opaque || (c != key)) *line = (palette[c] >> 8) | (palette[c] << 8);
+      line++;
+    }
+  }
+  else
+  {
+    uint16_t fg = palette ? palette[1] : _tft->bitmap_fg;
+    uint16_t bg = palette ? palette[0] : _tft->bitmap_bg;
+    fg = (fg >> 8) | (fg << 8);
+    bg = (bg >> 8) | (bg << 8);
+
+    uint8_t key = transp & 0x01;
+
+    for (; w--; x++, line++)
+    {
+      int32_t px = x, py = y;
+
+      if (_rotation == 1)      { px = _dwidth - y - 1;  py = x; }
+      else if (_rotation == 2) { px = _dwidth - x - 1;  py = _dheight - y - 1; }
+      else if (_rotation == 3) { px = y;                py = _dheight - x - 1; }
+
+      uint8_t c = (_img8[(px + py * _bitwidth)>>3] >> (7 - (px & 0x7))) & 0x01;
+      if (opaque || (c != key)) *line = c ? fg : bg;
+    }
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           readPixelValue
 ** Description:             Read the color map index of a pixel at defined coordinates
@@ -817,6 +1048,8 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_
   if (xs + ws >= (int32_t)_iwidth)  ws = _iwidth  - xs;
   if (ys + hs >= (int32_t)_iheight) hs = _iheight - ys;
 
+  if (_dirtyTracking) markDirty(xs, ys, ws, hs);
+
   if (_bpp == 16) // Plot a 16 bpp image into a 16 bpp Sprite
   {
     for (int32_t yp = yo; yp < yo + hs; yp++)
@@ -922,6 +1155,8 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const u
   if (xs + ws >= (int32_t)_iwidth)  ws = _iwidth  - xs;
   if (ys + hs >= (int32_t)_iheight) hs = _iheight - ys;
 
+  if (_dirtyTracking) markDirty(xs, ys, ws, hs);
+
   if (_bpp == 16) // Plot a 16 bpp image into a 16 bpp Sprite
   {
     for (int32_t yp = yo; yp < yo + hs; yp++)
@@ -1048,6 +1283,8 @@ void TFT_eSprite::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
     _ys = y0;
     _xe = x1;
     _ye = y1;
+
+    if (_dirtyTracking) markDirty(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
   }
 
   _xptr = _xs;
@@ -1188,6 +1425,8 @@ void TFT_eSprite::setScrollRect(int32_t x, int32_t y, int32_t w, int32_t h, uint
 *************************************************************************************x*/
 void TFT_eSprite::scroll(int16_t dx, int16_t dy)
 {
+  if (_dirtyTracking) markDirty(_sx, _sy, _sw, _sh);
+
   if (abs(dx) >= _sw || abs(dy) >= _sh)
   {
     fillRect (_sx, _sy, _sw, _sh, _scolor);
@@ -1241,24 +1480,26 @@ void TFT_eSprite::scroll(int16_t dx, int16_t dy)
       fyp += iw;
     }
   }
-  else if (_bpp == 4)
+  else if ((_bpp == 4) || ((_bpp == 1) && (_rotation == 0)))
   {
-    // could optimize for scrolling by even # pixels using memove (later)
-    if (dx >  0) { tx += w; fx += w; } // Start from right edge
+    // Pixels are packed most significant bits first, so each line is moved as a run of bits
+    int32_t lw = (_bpp == 4) ? _iwidth : _bitwidth; // pixels in a line of memory
+    if (dy > 0) lw = -lw;
+
+    uint32_t fp = (fx + fy * abs(lw)) * _bpp;
+    uint32_t tp = (tx + ty * abs(lw)) * _bpp;
+
     while (h--)
-    { // move pixels one by one
-      for (uint16_t xp = 0; xp < w; xp++)
-      {
-        if (dx <= 0) drawPixel(tx + xp, ty, readPixelValue(fx + xp, fy));
-        if (dx >  0) drawPixel(tx - xp, ty, readPixelValue(fx - xp, fy));
-      }
-      if (dy <= 0)  { ty++; fy++; }
-      else  { ty--; fy--; }
+    {
+      moveBits(_img8, tp, _img8, fp, w * _bpp);
+      tp += lw * _bpp;
+      fp += lw * _bpp;
     }
   }
-  else if (_bpp == 1 )
+  else if (_bpp == 1)
   {
-    if (dx >  0) { tx += w; fx += w; } // Start from right edge
+    // Rotated Sprite, the lines of the scroll zone are not lines in memory
+    if (dx >  0) { tx += w - 1; fx += w - 1; } // Start from right edge
     while (h--)
     { // move pixels one by one
       for (uint16_t xp = 0; xp < w; xp++)
@@ -1280,6 +1521,72 @@ void TFT_eSprite::scroll(int16_t dx, int16_t dy)
 }
 
 
+/***************************************************************************************
+** Function name:           moveBits
+** Description:             Move a run of bits, used to scroll 1 and 4 bpp lines
+*************************************************************************************x*/
+void TFT_eSprite::moveBits(uint8_t* dst, uint32_t db, uint8_t* src, uint32_t sb, uint32_t n)
+{
+  if (!n) return;
+
+  dst += db >> 3; db &= 7;
+  src += sb >> 3; sb &= 7;
+  if ((dst == src) && (db == sb)) return;
+
+  // Bytes of dst holding the first and last bits, and the bits of them to change
+  uint32_t last = (db + n - 1) >> 3;
+  uint8_t  firstMask = 0xFF >> db;
+  uint8_t  lastMask  = 0xFF << (7 - ((db + n - 1) & 7));
+  if (!last) firstMask &= lastMask;
+
+  // Copy from the end if the bits move right so none are overwritten before they are read
+  bool right = (dst > src) || ((dst == src) && (db > sb));
+
+  if (db == sb)
+  {
+    // Bytes line up, so whole bytes are moved with memmove() and the ends are masked
+    uint8_t first = src[0];
+    uint8_t end   = src[last];
+
+    if (last > 1) memmove(dst + 1, src + 1, last - 1);
+
+    dst[0] = (dst[0] & ~firstMask) | (first & firstMask);
+    if (last) dst[last] = (dst[last] & ~lastMask) | (end & lastMask);
+    return;
+  }
+
+  // Otherwise each byte of dst is made from two bytes of src, shifted
+  int32_t  off  = (int32_t)sb - (int32_t)db;      // src bit of dst bit 0
+  int32_t  j0   = off >> 3;                       // src byte of dst byte 0, may be -1
+  uint8_t  rs   = 8 - (off & 7);
+  int32_t  srcLast = (sb + n - 1) >> 3;           // last byte of src holding bits to move
+
+  // The end bytes may need src bytes outside the bits being moved
+  auto edge = [&](uint32_t k, uint8_t mask) {
+    int32_t j  = j0 + k;
+    uint8_t hi = (j >= 0) ? src[j] : 0;
+    uint8_t lo = (j + 1 <= srcLast) ? src[j + 1] : 0;
+    uint8_t val = (((uint16_t)hi << 8) | lo) >> rs;
+    dst[k] = (dst[k] & ~mask) | (val & mask);
+  };
+
+  if (!last) { edge(0, firstMask); return; }
+
+  if (right)
+  {
+    edge(last, lastMask);
+    for (uint32_t k = last - 1; k > 0; k--) dst[k] = (((uint16_t)src[j0 + k] << 8) | src[j0 + k + 1]) >> rs;
+    edge(0, firstMask);
+  }
+  else
+  {
+    edge(0, firstMask);
+    for (uint32_t k = 1; k < last; k++) dst[k] = (((uint16_t)src[j0 + k] << 8) | src[j0 + k + 1]) >> rs;
+    edge(last, lastMask);
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           fillSprite
 ** Description:             Fill the whole sprite with defined colour
@@ -1288,6 +1595,8 @@ void TFT_eSprite::fillSprite(uint32_t color)
 {
   if (!_created ) return;
 
+  if (_dirtyTracking) markDirty(0, 0, _iwidth, _iheight);
+
   // Use memset if possible as it is super fast
   if(( (uint8_t)color == (uint8_t)(color>>8) ) && _bpp == 16)
                     memset(_img,  (uint8_t)color, _iwidth * _iheight * 2);
@@ -1394,6 +1703,8 @@ void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color)
   if ((x < 0) || (y < 0) || !_created) return;
   if ((x >= _iwidth) || (y >= _iheight)) return;
 
+  if (_dirtyTracking) markDirty(x, y, 1, 1);
+
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
@@ -1511,6 +1822,8 @@ void TFT_eSprite::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
 
   if (h < 1) return;
 
+  if (_dirtyTracking) markDirty(x, y, 1, h);
+
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
@@ -1566,6 +1879,8 @@ void TFT_eSprite::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
 
   if (w < 1) return;
 
+  if (_dirtyTracking) markDirty(x, y, w, 1);
+
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
@@ -1625,6 +1940,8 @@ void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t
 
   if ((w < 1) || (h < 1)) return;
 
+  if (_dirtyTracking) markDirty(x, y, w, h);
+
   int32_t yp = _iwidth * y + x;
 
   if (_bpp == 16)
@@ -1653,50 +1970,15 @@ void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t
   {
     uint8_t c1 = (uint8_t)color & 0x0F;
     uint8_t c2 = c1 | ((c1 << 4) & 0xF0);
-    if ((x & 0x01) == 0 && (w & 0x01) == 0)
-    {
-      yp = (yp >> 1);
-      while (h--)
-      {
-        memset(_img4 + yp, c2, (w>>1));
-        yp += (_iwidth >> 1);
-      }
-    }
-    else if ((x & 0x01) == 0)
-    {
-      // same as above but you have a hangover on the right.
-      yp = (yp >> 1);
-      while (h--)
-      {
-        if (w > 1)
-          memset(_img4 + yp, c2, (w-1)>>1);
-        // handle the rightmost pixel by calling drawPixel
-        drawPixel(x+w-1, y+h, c1);
-        yp += (_iwidth >> 1);
-      }
-    }
-    else if ((w & 0x01) == 1)
-    {
-      yp = (yp + 1) >> 1;
-      while (h--) {
-        drawPixel(x, y+h-1, color & 0x0F);
-        if (w > 1)
-          memset(_img4 + (yp + ((x-1)>>1)), c2, (w-1)>>1);
-        // same as above but you have a hangover on the left instead
-        yp += (_iwidth >> 1);
-      }
-    }
-    else
+    while (h--)
     {
-      yp = (yp + 1) >> 1;
-      while (h--) {
-        drawPixel(x, y+h-1, color & 0x0F);
-        drawPixel(x+w-1, y+h-1, color & 0x0F);
-        if (w > 2)
-          memset(_img4 + (yp + ((x-1)>>1)), c2, (w-2)>>1);
-        // maximal hacking, single pixels on left and right.
-        yp += (_iwidth >> 1);
-      }
+      // Even pixels are bits 7 .. 4, odd pixels bits 3 .. 0
+      uint8_t* ptr = _img4 + (yp >> 1);
+      int32_t  ww  = w;
+      if (x & 0x01) { *ptr = (*ptr & 0xF0) | c1; ptr++; ww--; }
+      if (ww > 1) { memset(ptr, c2, ww >> 1); ptr += ww >> 1; }
+      if (ww & 0x01) *ptr = (*ptr & 0x0F) | (c1 << 4);
+      yp += _iwidth;
     }
   }
   else
@@ -2194,6 +2476,8 @@ int16_t TFT_eSprite::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t fo
 *************************************************************************************x*/
 bool TFT_eSprite::drawGlyph(uint16_t code)
 {
+  if (!sf->use()) return false; // Reload if unloaded to make room for another font
+
   if (code < 0x21)
   {
     if (code == 0x20) {
@@ -2251,51 +2535,51 @@ bool TFT_eSprite::drawGlyph(uint16_t code)
 
     }
 
-    uint8_t* pbuffer = nullptr;
-
-
-      sf->fontFile.seek(sf->gBitmap[gNum], fs::SeekSet); // This is slow for a significant position shift!
-      pbuffer =  (uint8_t*)malloc(sf->gWidth[gNum]);
-
-
-    int16_t  xs = 0;
-    uint16_t dl = 0;
-    uint8_t pixel = 0;
-
-    for (int32_t y = 0; y < sf->gHeight[gNum]; y++)
+    // 1 bpp Sprites can be rotated so are drawn a pixel at a time
+    if (!blendGlyph(gNum, this->cursor_x + sf->gdX[gNum], this->cursor_y + sf->gFont.maxAscent - sf->gdY[gNum], fg, bg))
     {
+      uint8_t bpp;
+      const uint8_t* gBuffer = sf->glyphBitmap(gNum, &bpp);
 
-        sf->fontFile.read(pbuffer, sf->gWidth[gNum]);
+      int16_t  xs = 0;
+      uint16_t dl = 0;
+      uint8_t pixel = 0;
 
-      for (int32_t x = 0; x < sf->gWidth[gNum]; x++)
+      for (int32_t y = 0; y < sf->gHeight[gNum]; y++)
       {
 
-         pixel = pbuffer[x];
+        const uint8_t* row = gBuffer + y * sf->gWidth[gNum];
+        uint16_t index = y * sf->gWidth[gNum];
 
-        if (pixel)
+        for (int32_t x = 0; x < sf->gWidth[gNum]; x++)
         {
-          if (pixel != 0xFF)
+
+           // 4 and 2 bpp bitmaps are blended straight from the packed pixels
+           if (bpp == 8) pixel = row[x];
+           else pixel = TFT_eSPI_SmoothFont::glyphAlpha(gBuffer, bpp, index + x);
+
+          if (pixel)
           {
-            if (dl) { drawFastHLine( xs, y + this->cursor_y + sf->gFont.maxAscent - sf->gdY[gNum], dl, fg); dl = 0; }
-            if (_bpp != 1) drawPixel(x + this->cursor_x + sf->gdX[gNum], y + this->cursor_y + sf->gFont.maxAscent - sf->gdY[gNum], alphaBlend(pixel, fg, bg));
-            else if (pixel>127) drawPixel(x + this->cursor_x + sf->gdX[gNum], y + this->cursor_y + sf->gFont.maxAscent - sf->gdY[gNum], fg);
+            if (pixel != 0xFF)
+            {
+              if (dl) { drawFastHLine( xs, y + this->cursor_y + sf->gFont.maxAscent - sf->gdY[gNum], dl, fg); dl = 0; }
+              if (pixel>127) drawPixel(x + this->cursor_x + sf->gdX[gNum], y + this->cursor_y + sf->gFont.maxAscent - sf->gdY[gNum], fg);
+            }
+            else
+            {
+              if (dl==0) xs = x + this->cursor_x + sf->gdX[gNum];
+              dl++;
+            }
           }
           else
           {
-            if (dl==0) xs = x + this->cursor_x + sf->gdX[gNum];
-            dl++;
+            if (dl) { drawFastHLine( xs, y + this->cursor_y + sf->gFont.maxAscent - sf->gdY[gNum], dl, fg); dl = 0; }
           }
         }
-        else
-        {
-          if (dl) { drawFastHLine( xs, y + this->cursor_y + sf->gFont.maxAscent - sf->gdY[gNum], dl, fg); dl = 0; }
-        }
+        if (dl) { drawFastHLine( xs, y + this->cursor_y + sf->gFont.maxAscent - sf->gdY[gNum], dl, fg); dl = 0; }
       }
-      if (dl) { drawFastHLine( xs, y + this->cursor_y + sf->gFont.maxAscent - sf->gdY[gNum], dl, fg); dl = 0; }
     }
 
-    if (pbuffer) free(pbuffer);
-
     if (newSprite)
     {
       pushSprite(this->cursor_x + sf->gdX[gNum], this->cursor_y, bg);
@@ -2314,6 +2598,76 @@ bool TFT_eSprite::drawGlyph(uint16_t code)
 }
 
 
+/***************************************************************************************
+** Function name:           blendGlyph
+** Description:             Blend a glyph straight into the Sprite memory
+*************************************************************************************x*/
+// Edge pixels are blended with the Sprite pixel underneath rather than the text
+// background colour, so text looks right over gradients and images. The blend table
+// for the text colours is used where the pixel underneath is the background colour.
+bool TFT_eSprite::blendGlyph(uint16_t gNum, int32_t x, int32_t y, uint16_t fg, uint16_t bg)
+{
+  if ((_bpp == 1) || !_created) return false;
+
+  uint8_t bpp;
+  const uint8_t* gBuffer = sf->glyphBitmap(gNum, &bpp);
+  const uint16_t* blend  = blendColours(fg, bg);
+  uint8_t  bg8 = color16to8(bg);       // Background as stored in an 8 bpp Sprite
+
+  int32_t gw = sf->gWidth[gNum];
+
+  // Clip the bitmap to the Sprite
+  int32_t xs = (x < 0) ? -x : 0;
+  int32_t ys = (y < 0) ? -y : 0;
+  int32_t xe = (x + gw > _iwidth) ? _iwidth - x : gw;
+  int32_t ye = (y + sf->gHeight[gNum] > _iheight) ? _iheight - y : sf->gHeight[gNum];
+
+  if (_dirtyTracking) markDirty(x + xs, y + ys, xe - xs, ye - ys);
+
+  for (int32_t gy = ys; gy < ye; gy++)
+  {
+    uint32_t index = gy * gw;          // First glyph pixel of the row
+    uint32_t ptr   = (y + gy) * _iwidth + x; // Sprite pixel of the first glyph pixel
+
+    for (int32_t gx = xs; gx < xe; gx++)
+    {
+      // 4 and 2 bpp bitmaps are blended straight from the packed pixels
+      uint8_t alpha = (bpp == 8) ? gBuffer[index + gx] : TFT_eSPI_SmoothFont::glyphAlpha(gBuffer, bpp, index + gx);
+      if (!alpha) continue;
+
+      if (_bpp == 16)
+      {
+        uint16_t colour = fg;
+        if (alpha != 0xFF) {
+          uint16_t under = _img[ptr + gx];
+          under = (under >> 8) | (under << 8);
+          colour = (blend && (under == bg)) ? blend[alpha >> SMOOTH_BLEND_SHIFT] : alphaBlend(alpha, fg, under);
+        }
+        _img[ptr + gx] = (colour >> 8) | (colour << 8);
+      }
+      else if (_bpp == 8)
+      {
+        uint16_t colour = fg;
+        if (alpha != 0xFF) {
+          uint8_t under = _img8[ptr + gx];
+          colour = (blend && (under == bg8)) ? blend[alpha >> SMOOTH_BLEND_SHIFT] : alphaBlend(alpha, fg, color8to16(under));
+        }
+        _img8[ptr + gx] = color16to8(colour);
+      }
+      else // 4 bpp, colours are colour map indexes so cannot be blended
+      {
+        if (alpha < 128) continue;
+        uint32_t i = (ptr + gx) >> 1;
+        if ((x + gx) & 1) _img4[i] = (_img4[i] & 0xF0) | (fg & 0x0F);
+        else _img4[i] = (_img4[i] & 0x0F) | ((fg & 0x0F) << 4);
+      }
+    }
+  }
+
+  return true;
+}
+
+
 /***************************************************************************************
 ** Function name:           printToSprite
 ** Description:             Write a string to the sprite cursor position
@@ -2335,7 +2689,7 @@ void TFT_eSprite::printToSprite(String string)
 *************************************************************************************x*/
 void TFT_eSprite::printToSprite(char *cbuffer, uint16_t len) //String string)
 {
-  if(!this->fontLoaded) return;
+  if(!this->fontLoaded || !sf->use()) return;
 
   uint16_t n = 0;
   bool newSprite = !_created;
@@ -5,6 +5,11 @@
 // graphics are written to the Sprite rather than the TFT.
 ***************************************************************************************/
 
+// Rectangles recorded by a Sprite for pushDirty() before they are merged to make room
+#ifndef SPRITE_DIRTY_RECTS
+  #define SPRITE_DIRTY_RECTS 8
+#endif
+
 class TFT_eSprite : public TFT_eSPI {
 
  public:
@@ -127,6 +132,19 @@ class TFT_eSprite : public TFT_eSPI {
   void     pushSprite(int32_t x, int32_t y);
   void     pushSprite(int32_t x, int32_t y, uint16_t transparent);
 
+           // Record the areas drawn in the Sprite as up to SPRITE_DIRTY_RECTS rectangles, merged when
+           // they overlap or touch, so pushDirty() only sends what has changed. Enabling tracking,
+           // creating the Sprite or changing the palette makes the whole Sprite dirty.
+  void     setDirtyTracking(bool enable);
+           // Add an area, e.g. one changed through the pointer returned by createSprite()
+  void     markDirty(int32_t x, int32_t y, int32_t w, int32_t h);
+           // Push the dirty areas to the TFT with the Sprite top left at x,y then clear them
+  void     pushDirty(int32_t x, int32_t y);
+
+           // Used by pushLayers(), copy the pixels of Sprite row y from x to x + w - 1 that are not
+           // the transparent colour into a line of colours ready to send, x may be negative
+  void     composeLine(uint16_t* line, int32_t x, int32_t w, int32_t y, uint32_t transp, const uint16_t* palette);
+
   int16_t  drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font),
            drawChar(uint16_t uniCode, int32_t x, int32_t y);
 
@@ -150,8 +168,23 @@ class TFT_eSprite : public TFT_eSPI {
            // Reserve memory for the Sprite and return a pointer
   void*    callocSprite(int16_t width, int16_t height, uint8_t frames = 1);
 
+           // Move n bits, most significant first, from bit sb of src to bit db of dst, for
+           // scrolling 1 and 4 bpp Sprites a line at a time. The bits may overlap.
+  void     moveBits(uint8_t* dst, uint32_t db, uint8_t* src, uint32_t sb, uint32_t n);
+
  protected:
 
+#ifdef SMOOTH_FONT
+           // Smooth font glyphs are drawn one at a time into the Sprite, not as TFT strips
+  bool     drawStringStrip(const char * /*string*/, int32_t /*poX*/, int32_t /*poY*/, int32_t /*cwidth*/, uint8_t /*padding*/, textRun * /*run*/) { return false; }
+  uint16_t drawGlyphRun(const uint8_t * /*string*/, uint16_t /*len*/) { return 0; }
+  bool     drawGlyphCells(const glyphCell * /*cell*/, uint16_t /*cells*/, int32_t /*y*/) { return false; }
+
+           // Blend a glyph into the Sprite memory over the pixels already there, x,y is the
+           // top left of the glyph bitmap. Returns false if drawPixel() must be used (1 bpp).
+  bool     blendGlyph(uint16_t gNum, int32_t x, int32_t y, uint16_t fg, uint16_t bg);
+#endif
+
   uint8_t  _bpp;     // bits per pixel (1, 8 or 16)
   uint16_t *_img;    // pointer to 16 bit sprite
   uint8_t  *_img8;   // pointer to  8 bit sprite
@@ -178,8 +211,22 @@ class TFT_eSprite : public TFT_eSPI {
 
   bool     _iswapBytes; // Swap the byte order for Sprite pushImage()
 
+  // An area drawn since the last pushDirty()
+  typedef struct
+  {
+    int16_t  x, y;
+    int16_t  w, h;
+  } dirtyRect;
+
+  dirtyRect _dirty[SPRITE_DIRTY_RECTS];
+  uint8_t  _dirtyCount = 0;     // Dirty rectangles recorded
+  bool     _dirtyTracking = false; // Record drawing for pushDirty()
+
   int32_t  _iwidth, _iheight; // Sprite memory image bit width and height (swapped during rotations)
   int32_t  _dwidth, _dheight; // Real display width and height (for <8bpp Sprites)
   int32_t  _bitwidth;         // Sprite image bit width for drawPixel (for <8bpp Sprites, not swapped)
 
+// Load the Sprite memory pool extension
+#include "Extensions/SpritePool.h"
+
 };
@@ -0,0 +1,211 @@
+/***************************************************************************************
+// Sprite memory pool, see SpritePool.h
+***************************************************************************************/
+
+// Each byte of the map is 0 inside a block, or for the first smallest block of a block
+// its order and POOL_FREE or POOL_USED
+#define POOL_FREE 0x40
+#define POOL_USED 0x80
+
+uint8_t*                      TFT_eSprite::_poolArena  = NULL;
+uint8_t*                      TFT_eSprite::_poolMap    = NULL;
+uint32_t                      TFT_eSprite::_poolBlocks = 0;
+TFT_eSprite::poolBlock*       TFT_eSprite::_poolFree[SPRITE_POOL_ORDERS];
+TFT_eSprite::spritePoolStats  TFT_eSprite::_poolStats;
+
+/***************************************************************************************
+** Function name:           createSpritePool
+** Description:             Reserve the memory for the Sprite memory pool
+*************************************************************************************x*/
+bool TFT_eSprite::createSpritePool(uint32_t bytes, bool psram)
+{
+  if (_poolArena) return false;
+
+  uint32_t blocks = bytes / SPRITE_POOL_BLOCK;
+  if (blocks < 1) return false;
+
+  _poolMap = (uint8_t*)calloc(blocks, 1);
+  if (!_poolMap) return false;
+
+#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
+  if (psram && psramFound()) _poolArena = (uint8_t*)ps_malloc(blocks * SPRITE_POOL_BLOCK);
+  else
+#else
+  (void)psram;
+#endif
+  _poolArena = (uint8_t*)malloc(blocks * SPRITE_POOL_BLOCK);
+
+  if (!_poolArena)
+  {
+    free(_poolMap);
+    _poolMap = NULL;
+    return false;
+  }
+
+  _poolBlocks = blocks;
+  for (uint8_t i = 0; i < SPRITE_POOL_ORDERS; i++) _poolFree[i] = NULL;
+
+  // Cut the arena into the largest blocks that start on a multiple of their size
+  for (uint32_t index = 0; index < blocks; )
+  {
+    uint8_t order = 0;
+    while ((order + 1 < SPRITE_POOL_ORDERS) && !(index & ((2 << order) - 1)) && (index + (2 << order) <= blocks)) order++;
+
+    poolInsert(index, order);
+    index += 1 << order;
+  }
+
+  _poolStats = { blocks * SPRITE_POOL_BLOCK, 0, 0, 0, 0, 0, 0 };
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           deleteSpritePool
+** Description:             Free the Sprite memory pool if no Sprite uses it
+*************************************************************************************x*/
+bool TFT_eSprite::deleteSpritePool(void)
+{
+  if (!_poolArena || _poolStats.used) return false;
+
+  free(_poolArena);
+  free(_poolMap);
+  _poolArena = NULL;
+  _poolMap = NULL;
+  _poolBlocks = 0;
+
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           getSpritePoolStats
+** Description:             Return the Sprite memory pool statistics
+*************************************************************************************x*/
+TFT_eSprite::spritePoolStats TFT_eSprite::getSpritePoolStats(void)
+{
+  spritePoolStats stats = _poolStats;
+  if (!_poolArena) return stats;
+
+  stats.largestFree = 0;
+  for (int8_t order = SPRITE_POOL_ORDERS - 1; order >= 0; order--)
+  {
+    if (_poolFree[order]) { stats.largestFree = SPRITE_POOL_BLOCK << order; break; }
+  }
+
+  uint32_t unused = stats.size - stats.used;
+  stats.fragmentation = unused ? (uint64_t)(unused - stats.largestFree) * 100 / unused : 0;
+
+  return stats;
+}
+
+
+/***************************************************************************************
+** Function name:           poolInsert
+** Description:             Add a block to the free blocks
+*************************************************************************************x*/
+void TFT_eSprite::poolInsert(uint32_t index, uint8_t order)
+{
+  poolBlock* block = (poolBlock*)(_poolArena + index * SPRITE_POOL_BLOCK);
+
+  block->prev = NULL;
+  block->next = _poolFree[order];
+  if (block->next) block->next->prev = block;
+  _poolFree[order] = block;
+
+  _poolMap[index] = POOL_FREE | order;
+}
+
+
+/***************************************************************************************
+** Function name:           poolRemove
+** Description:             Take a block from the free blocks
+*************************************************************************************x*/
+void TFT_eSprite::poolRemove(uint32_t index, uint8_t order)
+{
+  poolBlock* block = (poolBlock*)(_poolArena + index * SPRITE_POOL_BLOCK);
+
+  if (block->prev) block->prev->next = block->next;
+  else _poolFree[order] = block->next;
+  if (block->next) block->next->prev = block->prev;
+
+  _poolMap[index] = 0;
+}
+
+
+/***************************************************************************************
+** Function name:           poolCalloc
+** Description:             Take a cleared block of at least bytes from the pool, or NULL
+*************************************************************************************x*/
+void* TFT_eSprite::poolCalloc(uint32_t bytes)
+{
+  if (!_poolArena) return NULL;
+
+  uint8_t order = 0;
+  while ((order < SPRITE_POOL_ORDERS) && ((uint32_t)SPRITE_POOL_BLOCK << order) < bytes) order++;
+
+  // Smallest free block that is large enough
+  uint8_t from = order;
+  while ((from < SPRITE_POOL_ORDERS) && !_poolFree[from]) from++;
+
+  if (from >= SPRITE_POOL_ORDERS)
+  {
+    _poolStats.fails++;
+    return NULL;
+  }
+
+  uint32_t index = ((uint8_t*)_poolFree[from] - _poolArena) / SPRITE_POOL_BLOCK;
+  poolRemove(index, from);
+
+  // Split it, freeing the upper halves
+  while (from > order)
+  {
+    from--;
+    poolInsert(index + (1 << from), from);
+  }
+
+  _poolMap[index] = POOL_USED | order;
+
+  uint32_t size = SPRITE_POOL_BLOCK << order;
+  _poolStats.used += size;
+  if (_poolStats.used > _poolStats.highWater) _poolStats.highWater = _poolStats.used;
+  _poolStats.allocs++;
+
+  void* ptr = _poolArena + index * SPRITE_POOL_BLOCK;
+  memset(ptr, 0, size);
+
+  return ptr;
+}
+
+
+/***************************************************************************************
+** Function name:           poolFree
+** Description:             Return a block to the pool, merging it with free buddies
+*************************************************************************************x*/
+bool TFT_eSprite::poolFree(void* ptr)
+{
+  if (!_poolArena || ((uint8_t*)ptr < _poolArena)) return false;
+
+  uint32_t index = ((uint8_t*)ptr - _poolArena) / SPRITE_POOL_BLOCK;
+  if ((index >= _poolBlocks) || !(_poolMap[index] & POOL_USED)) return false;
+
+  uint8_t order = _poolMap[index] & (POOL_FREE - 1);
+  _poolStats.used -= SPRITE_POOL_BLOCK << order;
+
+  // The buddy of a block is the other half of the block of the next order
+  while (order + 1 < SPRITE_POOL_ORDERS)
+  {
+    uint32_t buddy = index ^ (1 << order);
+    if ((buddy >= _poolBlocks) || (_poolMap[buddy] != (POOL_FREE | order))) break;
+
+    poolRemove(buddy, order);
+    _poolMap[index] = 0;
+    if (buddy < index) index = buddy;
+    order++;
+  }
+
+  poolInsert(index, order);
+
+  return true;
+}
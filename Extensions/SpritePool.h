@@ -0,0 +1,56 @@
+/***************************************************************************************
+// Sprite memory pool, part of the TFT_eSprite class. An arena of RAM or PSRAM is reserved
+// once, e.g. at boot, and Sprites created after setAttribute(SPRITE_POOL, true) take their
+// memory from it with a buddy allocator, so Sprites that are often created and deleted do
+// not fragment the heap.
+***************************************************************************************/
+
+// Smallest block in the pool, a power of 2 of at least 16 bytes, one byte of RAM is used
+// for each block in the arena
+#ifndef SPRITE_POOL_BLOCK
+  #define SPRITE_POOL_BLOCK 64
+#endif
+
+// Block sizes from SPRITE_POOL_BLOCK up
+#define SPRITE_POOL_ORDERS 24
+
+ public:
+           // Reserve the pool, in PSRAM if psram is true and PSRAM is found. Returns false if
+           // there is a pool already or the memory is not available. A Sprite takes a block of
+           // the next power of 2 size, so the largest Sprite is the largest power of 2 in bytes.
+  static bool     createSpritePool(uint32_t bytes, bool psram = false);
+           // Free the pool, returns false if Sprites still use it
+  static bool     deleteSpritePool(void);
+
+  // Sprite memory pool statistics
+  typedef struct
+  {
+    uint32_t size;                       // Bytes in the pool
+    uint32_t used;                       // Bytes in blocks given to Sprites
+    uint32_t highWater;                  // Most bytes in use at one time
+    uint32_t largestFree;                // Largest block that can be given to a Sprite
+    uint8_t  fragmentation;              // Percent of the free memory outside the largest block
+    uint32_t allocs;                     // Sprites given memory from the pool
+    uint32_t fails;                      // Sprites that did not fit, they use the heap instead
+  } spritePoolStats;
+
+  static spritePoolStats getSpritePoolStats(void);
+
+ private:
+  // A free block, kept in the block itself
+  typedef struct poolBlock
+  {
+    struct poolBlock* next;
+    struct poolBlock* prev;
+  } poolBlock;
+
+  static uint8_t*   _poolArena;          // Pool memory, NULL when there is no pool
+  static uint8_t*   _poolMap;            // Order and state of the block starting at each block
+  static uint32_t   _poolBlocks;         // Smallest blocks in the arena
+  static poolBlock* _poolFree[SPRITE_POOL_ORDERS]; // Free blocks of each order
+  static spritePoolStats _poolStats;
+
+  static void     poolInsert(uint32_t index, uint8_t order);
+  static void     poolRemove(uint32_t index, uint8_t order);
+  static void*    poolCalloc(uint32_t bytes);
+  static bool     poolFree(void* ptr);   // Returns false if ptr is not in the pool
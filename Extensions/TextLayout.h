@@ -0,0 +1,68 @@
+/***************************************************************************************
+// A smooth font string laid out by TFT_eSPI::layoutText(). The UTF-8 string is decoded
+// once and the glyph numbers, cursor positions and line breaks are kept, so the text
+// can be measured and drawn with drawLayout() again without decoding or looking up
+// any glyphs. Lines are broken between words to fit the width given.
+***************************************************************************************/
+#pragma once
+
+class TFT_eSPI_TextLayout {
+
+ public:
+  TFT_eSPI_TextLayout() {};
+  ~TFT_eSPI_TextLayout() {
+    clear();
+  };
+
+  // The layout owns the memory it allocates, so it is not copied
+  TFT_eSPI_TextLayout(const TFT_eSPI_TextLayout&) = delete;
+  TFT_eSPI_TextLayout& operator=(const TFT_eSPI_TextLayout&) = delete;
+
+  void     clear(void) {
+               free(_text);
+               free(_line);
+               _text  = NULL;
+               _glyph = NULL;
+               _line  = NULL;
+               _font  = NULL;
+               _glyphs = _lines = _lineSpace = 0;
+               _width = 0;
+           };
+
+  uint16_t lines(void)  {return _lines;};              // Number of lines
+  int16_t  width(void)  {return _width;};              // Pixel width of the widest line
+  int16_t  height(void) {return _lines * _yAdvance;};  // Pixel height of all the lines
+  int16_t  lineWidth(uint16_t line) {return (line < _lines) ? _line[line].width : 0;};
+  const char* text(void) {return _text;};              // The string laid out, NULL if none
+
+ private:
+  friend class TFT_eSPI;
+
+  // A glyph placed on a line
+  typedef struct
+  {
+    uint16_t code;          // Unicode
+    uint16_t gNum;          // Glyph number, TFT_eSPI_SmoothFont::NO_GLYPH if not in the font
+    int16_t  x;             // Cursor x relative to the start of the line
+    uint8_t  xAdvance;      // Cursor x advance
+  } glyphPos;
+
+  // Glyphs on a line, spaces where a line is broken are left out
+  typedef struct
+  {
+    uint16_t first;         // First glyph
+    uint16_t count;         // Number of glyphs
+    int16_t  width;         // Pixel width, from the left of the line to the right of the last glyph
+  } textLine;
+
+  TFT_eSPI_SmoothFont* _font = NULL; // Font the text was laid out in
+  char*     _text   = NULL;  // Copy of the string, the glyphs follow in the same allocation
+  glyphPos* _glyph  = NULL;
+  textLine* _line   = NULL;
+  uint16_t  _glyphs = 0;
+  uint16_t  _lines  = 0;
+  uint16_t  _lineSpace = 0;  // Lines allocated
+  int32_t   _boxWidth = 0;   // Width the lines were broken to fit
+  int16_t   _width  = 0;
+  uint16_t  _yAdvance = 0;
+};
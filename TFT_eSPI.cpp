@@ -27,6 +27,7 @@
 #endif
 
 #ifdef SMOOTH_FONT
+  #include "Extensions/FontSource.cpp"
   #include "Extensions/SmoothFont.cpp"
 #endif
 /***************************************************************************************
@@ -71,6 +72,7 @@ inline void TFT_eSPI::end_tft_write(void){
 ***************************************************************************************/
 // Reads require a lower SPI clock rate than writes
 inline void TFT_eSPI::begin_tft_read(void){
+  if (_dlCount) flushDisplayList(); // Draw any recorded commands so they are read back
   DMA_BUSY_CHECK; // Wait for any DMA transfer to complete before changing SPI settings
 #if defined (SPI_HAS_TRANSACTION) && defined (SUPPORT_TRANSACTIONS) && !defined(TFT_PARALLEL_8_BIT)
   if (locked) {
@@ -207,6 +209,8 @@ TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
 #endif
   _psram_enable = false;
 
+  _spritePool = false;
+
   addr_row = 0xFFFF;
   addr_col = 0xFFFF;
 
@@ -431,6 +435,7 @@ void TFT_eSPI::init(uint8_t tc)
 ***************************************************************************************/
 void TFT_eSPI::setRotation(uint8_t m)
 {
+  flushDisplayList(); // Recorded commands are for the old rotation
 
   begin_tft_write();
 
@@ -535,6 +540,10 @@ void TFT_eSPI::spiwrite(uint8_t c)
 ***************************************************************************************/
 void TFT_eSPI::writecommand(uint8_t c)
 {
+  // The command could change the window
+  addr_row = 0xFFFF;
+  addr_col = 0xFFFF;
+
   begin_tft_write();
 
   DC_C;
@@ -1685,6 +1694,8 @@ void TFT_eSPI::drawCircleHelper( int32_t x0, int32_t y0, int32_t r, uint8_t corn
 // Improved algorithm avoids repetition of lines
 void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
 {
+  if (drawCachedSpans(SPAN_CIRCLE, x0, y0, r, 0, color)) return;
+
   int32_t  x  = 0;
   int32_t  dx = 1;
   int32_t  dy = r+r;
@@ -1693,13 +1704,13 @@ void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
   //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
   inTransaction = true;
 
-  drawFastHLine(x0 - r, y0, dy+1, color);
+  shapeSpan(x0 - r, y0, dy+1, color);
 
   while(x<r){
 
     if(p>=0) {
-      drawFastHLine(x0 - x + 1, y0 + r, dx-1, color);
-      drawFastHLine(x0 - x + 1, y0 - r, dx-1, color);
+      shapeSpan(x0 - x + 1, y0 + r, dx-1, color);
+      shapeSpan(x0 - x + 1, y0 - r, dx-1, color);
       dy-=2;
       p-=dy;
       r--;
@@ -1709,8 +1720,8 @@ void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
     p+=dx;
     x++;
 
-    drawFastHLine(x0 - r, y0 + x, dy+1, color);
-    drawFastHLine(x0 - r, y0 - x, dy+1, color);
+    shapeSpan(x0 - r, y0 + x, dy+1, color);
+    shapeSpan(x0 - r, y0 - x, dy+1, color);
 
   }
 
@@ -1726,6 +1737,8 @@ void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
 // Support drawing roundrects, changed to horizontal lines (faster in sprites)
 void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color)
 {
+  if (drawCachedSpans(SPAN_CORNERS, x0, y0, r, 0, color, cornername, delta)) return;
+
   int32_t f     = 1 - r;
   int32_t ddF_x = 1;
   int32_t ddF_y = -r - r;
@@ -1735,8 +1748,8 @@ void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corne
 
   while (y < r) {
     if (f >= 0) {
-      if (cornername & 0x1) drawFastHLine(x0 - y, y0 + r, y + y + delta, color);
-      if (cornername & 0x2) drawFastHLine(x0 - y, y0 - r, y + y + delta, color);
+      if (cornername & 0x1) shapeSpan(x0 - y, y0 + r, y + y + delta, color);
+      if (cornername & 0x2) shapeSpan(x0 - y, y0 - r, y + y + delta, color);
       r--;
       ddF_y += 2;
       f     += ddF_y;
@@ -1746,8 +1759,8 @@ void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t corne
     ddF_x += 2;
     f     += ddF_x;
 
-    if (cornername & 0x1) drawFastHLine(x0 - r, y0 + y, r + r + delta, color);
-    if (cornername & 0x2) drawFastHLine(x0 - r, y0 - y, r + r + delta, color);
+    if (cornername & 0x1) shapeSpan(x0 - r, y0 + y, r + r + delta, color);
+    if (cornername & 0x2) shapeSpan(x0 - r, y0 - y, r + r + delta, color);
   }
 }
 
@@ -1812,6 +1825,9 @@ void TFT_eSPI::fillEllipse(int16_t x0, int16_t y0, int32_t rx, int32_t ry, uint1
 {
   if (rx<2) return;
   if (ry<2) return;
+
+  if (drawCachedSpans(SPAN_ELLIPSE, x0, y0, rx, ry, color)) return;
+
   int32_t x, y;
   int32_t rx2 = rx * rx;
   int32_t ry2 = ry * ry;
@@ -1823,8 +1839,8 @@ void TFT_eSPI::fillEllipse(int16_t x0, int16_t y0, int32_t rx, int32_t ry, uint1
   inTransaction = true;
 
   for (x = 0, y = ry, s = 2*ry2+rx2*(1-2*ry); ry2*x <= rx2*y; x++) {
-    drawFastHLine(x0 - x, y0 - y, x + x + 1, color);
-    drawFastHLine(x0 - x, y0 + y, x + x + 1, color);
+    shapeSpan(x0 - x, y0 - y, x + x + 1, color);
+    shapeSpan(x0 - x, y0 + y, x + x + 1, color);
 
     if (s >= 0) {
       s += fx2 * (1 - y);
@@ -1834,8 +1850,8 @@ void TFT_eSPI::fillEllipse(int16_t x0, int16_t y0, int32_t rx, int32_t ry, uint1
   }
 
   for (x = rx, y = 0, s = 2*rx2+ry2*(1-2*rx); rx2*y <= ry2*x; y++) {
-    drawFastHLine(x0 - x, y0 - y, x + x + 1, color);
-    drawFastHLine(x0 - x, y0 + y, x + x + 1, color);
+    shapeSpan(x0 - x, y0 - y, x + x + 1, color);
+    shapeSpan(x0 - x, y0 + y, x + x + 1, color);
 
     if (s >= 0) {
       s += fy2 * (1 - x);
@@ -2028,6 +2044,133 @@ void TFT_eSPI::fillTriangle ( int32_t x0, int32_t y0, int32_t x1, int32_t y1, in
 }
 
 
+/***************************************************************************************
+** Function name:           fillPolygon
+** Description:             Draw a filled polygon using a sorted edge table
+***************************************************************************************/
+// The outline is included, so pixels on the edges joining the points are filled. Each
+// edge covers the scanlines from its top up to but not including its bottom, so the
+// bottom points and horizontal edges are added as spans of their own. The spans on a
+// scanline are then merged, giving one drawFastHLine() per scanline for a convex polygon.
+void TFT_eSPI::fillPolygon(const int16_t *xy, uint16_t points, uint32_t color)
+{
+  if (!points) return;
+
+  int32_t ymin = xy[1], ymax = xy[1];
+  for (uint16_t i = 1; i < points; i++) {
+    if (xy[i * 2 + 1] < ymin) ymin = xy[i * 2 + 1];
+    if (xy[i * 2 + 1] > ymax) ymax = xy[i * 2 + 1];
+  }
+
+  int32_t yEnd = min(ymax, (int32_t)height() - 1);
+  if ((ymax < 0) || (ymin > yEnd)) return;
+
+  // The active edges, then the edges and bottom points in the edge table and the spans of a
+  // scanline, in order of alignment so each array is aligned
+  uint16_t size = points + points / 2 + 1;
+  polyEdge** active = (polyEdge**)malloc(size * (sizeof(polyEdge*) + sizeof(polyEdge) + 2 * sizeof(int16_t)));
+  if (!active) return;
+  polyEdge*  edges  = (polyEdge*)(active + size);
+  int16_t*   spans  = (int16_t*)(edges + size);
+
+  uint16_t count = 0;
+  for (uint16_t i = 0; i < points; i++) {
+    int32_t x0 = xy[i * 2], y0 = xy[i * 2 + 1];
+    uint16_t j = (i + 1 < points) ? i + 1 : 0;
+    int32_t x1 = xy[j * 2], y1 = xy[j * 2 + 1];
+
+    polyEdge &e = edges[count++];
+
+    if (y0 == y1) {           // Horizontal edge
+      e.x = min(x0, x1); e.dx = max(x0, x1);
+      e.y0 = e.y1 = y0;
+      continue;
+    }
+
+    if (y0 > y1) { swap_coord(x0, x1); swap_coord(y0, y1); }
+
+    // Add 0.5 so the integer part is x rounded to the nearest pixel
+    e.dx = (int64_t)(x1 - x0) * 65536 / (y1 - y0);
+    e.x  = x0 * 65536 + 0x8000;
+    e.y0 = y0; e.y1 = y1;
+
+    // A point with both neighbours above is the bottom of the polygon, or of a part of it
+    uint16_t k = (j + 1 < points) ? j + 1 : 0;
+    if ((xy[i * 2 + 1] < xy[j * 2 + 1]) && (xy[k * 2 + 1] < xy[j * 2 + 1])) {
+      polyEdge &b = edges[count++];
+      b.x = b.dx = xy[j * 2];
+      b.y0 = b.y1 = xy[j * 2 + 1];
+    }
+  }
+
+  // Sort the edge table by the first scanline
+  qsort(edges, count, sizeof(polyEdge), [](const void* a, const void* b) {
+    return ((const polyEdge*)a)->y0 - ((const polyEdge*)b)->y0;
+  });
+
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  inTransaction = true;
+
+  uint16_t next = 0, live = 0;
+
+  for (int32_t y = max(ymin, (int32_t)0); y <= yEnd; y++)
+  {
+    // Remove the edges that have ended
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < live; i++) if (active[i]->y1 > y) active[n++] = active[i];
+    live = n;
+
+    // Add the edges that start on this scanline, or above the top of the screen
+    uint16_t first = next;
+    for (; (next < count) && (edges[next].y0 <= y); next++) {
+      polyEdge* e = &edges[next];
+      if ((e->y0 == e->y1) || (e->y1 <= y)) continue;
+      if (e->y0 < y) e->x += (int64_t)(y - e->y0) * e->dx;
+      active[live++] = e;
+    }
+
+    // Keep the active edges in x order, they only change order where edges cross
+    for (uint16_t i = 1; i < live; i++) {
+      polyEdge* e = active[i];
+      uint16_t k = i;
+      while (k && (active[k - 1]->x > e->x)) { active[k] = active[k - 1]; k--; }
+      active[k] = e;
+    }
+
+    // Pairs of edges bound the filled spans
+    n = 0;
+    for (uint16_t i = 0; i + 1 < live; i += 2) {
+      spans[n++] = active[i]->x >> 16;
+      spans[n++] = active[i + 1]->x >> 16;
+    }
+
+    // Insert the horizontal edges and bottom points on this scanline in x order
+    for (uint16_t i = first; i < next; i++) {
+      if ((edges[i].y0 != edges[i].y1) || (edges[i].y0 != y)) continue;
+      int16_t xs = edges[i].x, xe = edges[i].dx;
+      uint16_t k = n;
+      while (k && (spans[k - 2] > xs)) { spans[k] = spans[k - 2]; spans[k + 1] = spans[k - 1]; k -= 2; }
+      spans[k] = xs; spans[k + 1] = xe;
+      n += 2;
+    }
+
+    // Merge spans that overlap or touch
+    for (uint16_t i = 0; i < n; ) {
+      int32_t xs = spans[i], xe = spans[i + 1];
+      for (i += 2; (i < n) && (spans[i] <= xe + 1); i += 2) if (spans[i + 1] > xe) xe = spans[i + 1];
+      drawFastHLine(xs, y, xe - xs + 1, color);
+    }
+
+    for (uint16_t i = 0; i < live; i++) active[i]->x += active[i]->dx;
+  }
+
+  inTransaction = false;
+  end_tft_write();              // Does nothing if Sprite class uses this function
+
+  free(active);
+}
+
+
 /***************************************************************************************
 ** Function name:           drawBitmap
 ** Description:             Draw an image stored in an array on the TFT
@@ -2353,6 +2496,7 @@ int16_t TFT_eSPI::textWidth(const char *string, uint8_t font)
 
 #ifdef SMOOTH_FONT
   if(fontLoaded) {
+    if (!sf->use()) return 0; // Reload if unloaded to make room for another font
     while (*string) {
       uniCode = decodeUTF8(*string++);
       if (uniCode) {
@@ -2618,8 +2762,8 @@ void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
 {
   //begin_tft_write(); // Must be called before setWindow
 
-  addr_col = 0xFFFF;
-  addr_row = 0xFFFF;
+  // Recorded drawing goes first so the screen is drawn in order
+  if (_dlCount) replayDisplayList();
 
 #ifdef CGRAM_OFFSET
   x0+=colstart;
@@ -2628,15 +2772,32 @@ void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
   y1+=rowstart;
 #endif
 
+  // The TFT keeps the column and row ranges, so only send those that have changed
+  // e.g. the rows of a filled shape or a text scanline only need a new row
+  uint32_t col = ((uint32_t)(uint16_t)x0 << 16) | (uint16_t)x1;
+  uint32_t row = ((uint32_t)(uint16_t)y0 << 16) | (uint16_t)y1;
+
   // Column addr set
-  DC_C; tft_Write_8(TFT_CASET);
-  DC_D; tft_Write_32C(x0, x1);
+  if (addr_col != col) {
+    DC_C; tft_Write_8(TFT_CASET);
+    DC_D; tft_Write_32C(x0, x1);
+    addr_col = col;
+    winStats.sent += 5;
+  }
+  else winStats.skipped += 5;
 
   // Row addr set
-  DC_C; tft_Write_8(TFT_PASET);
-  DC_D; tft_Write_32C(y0, y1);
+  if (addr_row != row) {
+    DC_C; tft_Write_8(TFT_PASET);
+    DC_D; tft_Write_32C(y0, y1);
+    addr_row = row;
+    winStats.sent += 5;
+  }
+  else winStats.skipped += 5;
 
   DC_C; tft_Write_8(TFT_RAMWR);
+  winStats.sent++;
+  winStats.windows++;
 
   DC_D;
 
@@ -2691,6 +2852,8 @@ void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
   // Range checking
   if ((x < 0) || (y < 0) ||(x >= _width) || (y >= _height)) return;
 
+  if (_dlList) { recordRect(x, y, 1, 1, color); return; }
+
 #ifdef CGRAM_OFFSET
   x+=colstart;
   y+=rowstart;
@@ -2699,20 +2862,26 @@ void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
   begin_tft_write();
 
   // No need to send x if it has not changed (speeds things up)
-  if (addr_col != x) {
+  if (addr_col != (((uint32_t)x << 16) | x)) {
     DC_C; tft_Write_8(TFT_CASET);
     DC_D; tft_Write_32D(x);
-    addr_col = x;
+    addr_col = ((uint32_t)x << 16) | x;
+    winStats.sent += 5;
   }
+  else winStats.skipped += 5;
 
   // No need to send y if it has not changed (speeds things up)
-  if (addr_row != y) {
+  if (addr_row != (((uint32_t)y << 16) | y)) {
     DC_C; tft_Write_8(TFT_PASET);
     DC_D; tft_Write_32D(y);
-    addr_row = y;
+    addr_row = ((uint32_t)y << 16) | y;
+    winStats.sent += 5;
   }
+  else winStats.skipped += 5;
 
   DC_C; tft_Write_8(TFT_RAMWR);
+  winStats.sent++;
+  winStats.windows++;
   DC_D; tft_Write_16(color);
 
   end_tft_write();
@@ -2761,6 +2930,10 @@ void TFT_eSPI::startWrite(void)
 ***************************************************************************************/
 void TFT_eSPI::endWrite(void)
 {
+  // The sketch may have set a window or sent other commands
+  addr_row = 0xFFFF;
+  addr_col = 0xFFFF;
+
   inTransaction = false;
   DMA_BUSY_CHECK;         // Safety check - user code should have checked this!
   end_tft_write();
@@ -2815,7 +2988,18 @@ void TFT_eSPI::pushColors(uint16_t *data, uint32_t len, bool swap)
 // an efficient FastH/V Line draw routine for line segments of 2 pixels or more
 void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
 {
-  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  // Nothing to draw if the line is wholly off one side of the screen
+  if ((max(x0, x1) < 0) || (min(x0, x1) >= _width) || (max(y0, y1) < 0) || (min(y0, y1) >= _height)) return;
+
+  // The runs of a line that is all on the screen are sent without clipping each one,
+  // otherwise they are clipped by the line functions, which also record them in a display list
+  bool clip = (min(x0, x1) < 0) || (max(x0, x1) >= _width) ||
+              (min(y0, y1) < 0) || (max(y0, y1) >= _height) || _dlList;
+
+  // Keep the caller's transaction open, e.g. drawLines(). A display list records the
+  // runs so nothing is sent.
+  bool wasInTransaction = inTransaction;
+  if (!_dlList) begin_tft_write();
   inTransaction = true;
 
   bool steep = abs(y1 - y0) > abs(x1 - x0);
@@ -2842,13 +3026,17 @@ void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t
       err -= dy;
       if (err < 0) {
         err += dx;
-        if (dlen == 1) drawPixel(y0, xs, color);
+        if (!clip) { setWindow(y0, xs, y0, x0); pushBlock(color, dlen); }
+        else if (dlen == 1) drawPixel(y0, xs, color);
         else drawFastVLine(y0, xs, dlen, color);
         dlen = 0;
         y0 += ystep; xs = x0 + 1;
       }
     }
-    if (dlen) drawFastVLine(y0, xs, dlen, color);
+    if (dlen) {
+      if (!clip) { setWindow(y0, xs, y0, x1); pushBlock(color, dlen); }
+      else drawFastVLine(y0, xs, dlen, color);
+    }
   }
   else
   {
@@ -2857,16 +3045,54 @@ void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t
       err -= dy;
       if (err < 0) {
         err += dx;
-        if (dlen == 1) drawPixel(xs, y0, color);
+        if (!clip) { setWindow(xs, y0, x0, y0); pushBlock(color, dlen); }
+        else if (dlen == 1) drawPixel(xs, y0, color);
         else drawFastHLine(xs, y0, dlen, color);
         dlen = 0;
         y0 += ystep; xs = x0 + 1;
       }
     }
-    if (dlen) drawFastHLine(xs, y0, dlen, color);
+    if (dlen) {
+      if (!clip) { setWindow(xs, y0, x1, y0); pushBlock(color, dlen); }
+      else drawFastHLine(xs, y0, dlen, color);
+    }
   }
 
-  inTransaction = false;
+  inTransaction = wasInTransaction;
+  end_tft_write();
+}
+
+
+/***************************************************************************************
+** Function name:           drawLines
+** Description:             draw lines held as x0, y0, x1, y1 in an array
+***************************************************************************************/
+void TFT_eSPI::drawLines(const int16_t *xy, uint16_t lines, uint32_t color)
+{
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  bool wasInTransaction = inTransaction;
+  inTransaction = true;
+
+  for (; lines; lines--, xy += 4) drawLine(xy[0], xy[1], xy[2], xy[3], color);
+
+  inTransaction = wasInTransaction;
+  end_tft_write();
+}
+
+
+/***************************************************************************************
+** Function name:           drawPolyline
+** Description:             draw lines joining the points held as x, y in an array
+***************************************************************************************/
+void TFT_eSPI::drawPolyline(const int16_t *xy, uint16_t points, uint32_t color)
+{
+  //begin_tft_write();          // Sprite class can use this function, avoiding begin_tft_write()
+  bool wasInTransaction = inTransaction;
+  inTransaction = true;
+
+  for (; points > 1; points--, xy += 2) drawLine(xy[0], xy[1], xy[2], xy[3], color);
+
+  inTransaction = wasInTransaction;
   end_tft_write();
 }
 
@@ -2886,6 +3112,8 @@ void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
 
   if (h < 1) return;
 
+  if (_dlList) { recordRect(x, y, 1, h, color); return; }
+
   begin_tft_write();
 
   setWindow(x, y, x, y + h - 1);
@@ -2911,6 +3139,8 @@ void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
 
   if (w < 1) return;
 
+  if (_dlList) { recordRect(x, y, w, 1, color); return; }
+
   begin_tft_write();
 
   setWindow(x, y, x + w - 1, y);
@@ -2938,6 +3168,8 @@ void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t col
 
   if ((w < 1) || (h < 1)) return;
 
+  if (_dlList) { recordRect(x, y, w, h, color); return; }
+
   begin_tft_write();
 
   setWindow(x, y, x + w - 1, y + h - 1);
@@ -3046,7 +3278,15 @@ void TFT_eSPI::setAttribute(uint8_t attr_id, uint8_t param) {
 #endif
             _psram_enable = false;
             break;
-        //case 4: // TBD future feature control
+        case SPRITE_POOL:
+            _spritePool = param;
+            break;
+#ifdef SMOOTH_FONT
+        case BLEND_TABLES:
+            _blendTables = param;
+            break;
+#endif
+        //case 6: // TBD future feature control
         //    _tbd = param;
         //    break;
     }
@@ -3065,7 +3305,13 @@ uint8_t TFT_eSPI::getAttribute(uint8_t attr_id) {
             return _utf8;
         case PSRAM_ENABLE:
             return _psram_enable;
-        //case 3: // TBD future feature control
+        case SPRITE_POOL:
+            return _spritePool;
+#ifdef SMOOTH_FONT
+        case BLEND_TABLES: // ON/OFF control of smooth font alpha blend tables
+            return _blendTables;
+#endif
+        //case 6: // TBD future feature control
         //    return _tbd;
         //    break;
     }
@@ -3368,6 +3614,40 @@ size_t TFT_eSPI::write(uint8_t utf8)
 }
 
 
+/***************************************************************************************
+** Function name:           write
+** Description:             draw a string piped through serial stream
+***************************************************************************************/
+size_t TFT_eSPI::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+
+  while (n < size) {
+#ifdef SMOOTH_FONT
+    // Draw as many glyphs as possible in one window
+    if(fontLoaded && _utf8 && (decoderState == 0)) {
+      uint16_t used = drawGlyphRun(buffer + n, (size - n > 0xFFFF) ? 0xFFFF : size - n);
+      if (used) { n += used; continue; }
+
+      // Pass the next whole character to write() so the cursor is handled there
+      uint16_t next = 0;
+      decodeUTF8((uint8_t*)buffer + n, &next, size - n);
+      while (next--) {
+        if (write(buffer[n]) == 0) return n;
+        n++;
+      }
+      continue;
+    }
+#endif
+    // Stop at the first character that cannot be written, as Print does
+    if (write(buffer[n]) == 0) break;
+    n++;
+  }
+
+  return n;
+}
+
+
 /***************************************************************************************
 ** Function name:           drawChar
 ** Description:             draw a Unicode glyph onto the screen
@@ -3639,7 +3919,15 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
 {
   int16_t sumX = 0;
   uint8_t padding = 1, baseline = 0;
-  uint16_t cwidth = textWidth(string, font); // Find the pixel width of the string in the font
+  uint16_t cwidth;
+
+#ifdef SMOOTH_FONT
+  // The text run cache has the width of strings drawn before
+  textRun* run = fontLoaded ? findTextRun(string) : nullptr;
+  if (run) cwidth = run->cwidth;
+  else
+#endif
+  cwidth = textWidth(string, font); // Find the pixel width of the string in the font
   uint16_t cheight = 8 * textsize;
 
 #ifdef LOAD_GFXFF
@@ -3770,13 +4058,19 @@ int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8
 
 #ifdef SMOOTH_FONT
   if(fontLoaded) {
-    if (textcolor!=textbgcolor) fillRect(poX, poY, cwidth, cheight, textbgcolor);
+    // Try to draw the background, text and padding in one window
+    if (drawStringStrip(string, poX, poY, cwidth, padding, run)) padding = 0; // Padding done
+    else {
+      if (textcolor!=textbgcolor) fillRect(poX, poY, cwidth, cheight, textbgcolor);
 
-    setCursor(poX, poY);
+      setCursor(poX, poY);
+      prefetchString(string);
 
-    while (n < len) {
-      uint16_t uniCode = decodeUTF8((uint8_t*)string, &n, len - n);
-      drawGlyph(uniCode);
+      while (n < len) {
+        uint16_t uniCode = decodeUTF8((uint8_t*)string, &n, len - n);
+        drawGlyph(uniCode);
+      }
+      sf->endPrefetch();
     }
     sumX += cwidth;
     //fontFile.close();
@@ -4226,6 +4520,14 @@ void TFT_eSPI::getSetup(setup_t &tft_settings)
 
 #include "Extensions/Sprite.cpp"
 
+#include "Extensions/SpritePool.cpp"
+
+#include "Extensions/DisplayList.cpp"
+
+#include "Extensions/SpanCache.cpp"
+
+#include "Extensions/Layers.cpp"
+
 #ifdef SMOOTH_FONT
   #include "Extensions/Smooth_font.cpp"
 #endif
@@ -146,7 +146,39 @@
 
 // Load the Anti-aliased font extension
 #ifdef SMOOTH_FONT
+  // RAM budget for smooth font files held in RAM, see TFT_eSPI_SmoothFont::setResidentBudget()
+  #ifndef SMOOTH_FONT_BUDGET
+    #define SMOOTH_FONT_BUDGET 32768
+  #endif
+
+  // RAM limit for the glyph bitmaps of a string read ahead of drawing, 0 disables the prefetch
+  #ifndef SMOOTH_PREFETCH_BYTES
+    #define SMOOTH_PREFETCH_BYTES 4096
+  #endif
+
   #include "Extensions/SmoothFont.h"  // Loaded if SMOOTH_FONT is defined by user
+  #include "Extensions/TextLayout.h"  // Loaded if SMOOTH_FONT is defined by user
+
+  // RAM limit for drawing a smooth font string in one TFT window, see setStringBuffer()
+  #ifndef SMOOTH_STRIP_BYTES
+    #define SMOOTH_STRIP_BYTES 8192
+  #endif
+
+  // Number of text colour pairs with an alpha blend table, each uses 2 x SMOOTH_BLEND_LEVELS bytes
+  #ifndef SMOOTH_BLEND_TABLES
+    #define SMOOTH_BLEND_TABLES 4
+  #endif
+
+  // Alpha levels in a blend table, 256 is exact, 32 or 16 use less RAM but show banding
+  #if   SMOOTH_BLEND_LEVELS == 16
+    #define SMOOTH_BLEND_SHIFT 4
+  #elif SMOOTH_BLEND_LEVELS == 32
+    #define SMOOTH_BLEND_SHIFT 3
+  #else
+    #undef  SMOOTH_BLEND_LEVELS
+    #define SMOOTH_BLEND_LEVELS 256
+    #define SMOOTH_BLEND_SHIFT 0
+  #endif
 #endif
 
 // Create a null default font in case some fonts not used (to prevent crash)
@@ -357,6 +389,9 @@ swap_coord(T& a, T& b) { T t = a; a = b; b = t; }
 // Callback prototype for smooth font pixel colour read
 typedef uint16_t (*getColorCallback)(uint16_t x, uint16_t y);
 
+// Sprite class, the display list can draw through a Sprite band
+class TFT_eSprite;
+
 // Class functions and variables
 class TFT_eSPI : public Print {
 
@@ -435,6 +470,14 @@ class TFT_eSPI : public Print {
            drawTriangle(int32_t x1,int32_t y1, int32_t x2,int32_t y2, int32_t x3,int32_t y3, uint32_t color),
            fillTriangle(int32_t x1,int32_t y1, int32_t x2,int32_t y2, int32_t x3,int32_t y3, uint32_t color);
 
+           // Draw a batch of lines in one transaction, e.g. the traces of a chart or meter needles
+  void     drawLines(const int16_t *xy, uint16_t lines, uint32_t color),      // xy holds x0, y0, x1, y1 for each line
+           drawPolyline(const int16_t *xy, uint16_t points, uint32_t color);  // xy holds x, y for each point joined
+
+           // Fill a polygon with one span per scanline, the last point is joined to the first. Concave
+           // polygons are fine, where the outline crosses itself areas are filled alternately (even-odd)
+  void     fillPolygon(const int16_t *xy, uint16_t points, uint32_t color);  // xy holds x, y for each point
+
   // Image rendering
            // Swap the byte order for pushImage() and pushPixels() - corrects endianness
   void     setSwapBytes(bool swap);
@@ -538,6 +581,9 @@ class TFT_eSPI : public Print {
 
            // Support function to UTF8 decode and draw characters piped through print stream
   size_t   write(uint8_t);
+           // Strings piped through the print stream, smooth fonts draw runs of glyphs in one window
+  size_t   write(const uint8_t *buffer, size_t size);
+  using    Print::write;
   
            // Used by Smooth font class to fetch a pixel colour for the anti-aliasing
   void     setCallback(getColorCallback getCol);
@@ -630,15 +676,30 @@ class TFT_eSPI : public Print {
   void     writeColor(uint16_t color, uint32_t len); // Deprecated, use pushBlock()
   void     endWrite(void);                           // End SPI transaction
 
+  // Bus bytes used to set address windows. A column or row range the same as the last one
+  // sent is not sent again, see setWindow()
+  typedef struct
+  {
+    uint32_t windows;                  // Windows set by setWindow() and drawPixel()
+    uint32_t sent;                     // CASET, PASET and RAMWR command and address bytes sent
+    uint32_t skipped;                  // Bytes not sent as the column or row range was unchanged
+  } windowStats;
+
+windowStats winStats = { 0, 0, 0 };
+
   // Set/get an arbitrary library configuration attribute or option
   //       Use to switch ON/OFF capabilities such as UTF8 decoding - each attribute has a unique ID
   //       id = 0: reserved - may be used in fuuture to reset all attributes to a default state
   //       id = 1: Turn on (a=true) or off (a=false) GLCD cp437 font character error correction
   //       id = 2: Turn on (a=true) or off (a=false) UTF8 decoding
   //       id = 3: Enable or disable use of ESP32 PSRAM (if available)
+  //       id = 4: Turn on (a=true) or off (a=false) smooth font alpha blend tables
+  //       id = 5: Take Sprite memory from the Sprite memory pool (a=true) or the heap (a=false)
            #define CP437_SWITCH 1
            #define UTF8_SWITCH  2
            #define PSRAM_ENABLE 3
+           #define BLEND_TABLES 4
+           #define SPRITE_POOL  5
   void     setAttribute(uint8_t id = 0, uint8_t a = 0); // Set attribute value
   uint8_t  getAttribute(uint8_t id = 0);                // Get attribute value
 
@@ -734,6 +795,14 @@ class TFT_eSPI : public Print {
 
   getColorCallback getColor = nullptr; // Smooth font callback function pointer
 
+           // An edge of the polygon being filled, or a span to fill on one scanline if y0 == y1
+  typedef struct
+  {
+    int32_t  x, dx;                    // x on the current scanline and the x step per scanline, 16.16
+                                       // fixed point, or for a span the first and last x
+    int16_t  y0, y1;                   // First scanline and the scanline after the last
+  } polyEdge;
+
  //-------------------------------------- protected ----------------------------------//
  protected:
 
@@ -741,7 +810,7 @@ class TFT_eSPI : public Print {
 
   int32_t  _init_width, _init_height; // Display w/h as input, used by setRotation()
   int32_t  _width, _height;           // Display w/h as modified by current rotation
-  int32_t  addr_row, addr_col;        // Window position - used to minimise window commands
+  uint32_t addr_row, addr_col;        // Last row and column ranges sent, start << 16 | end, 0xFFFF if unknown
 
   uint32_t fontsloaded;               // Bit field of fonts loaded
 
@@ -759,6 +828,7 @@ class TFT_eSPI : public Print {
   bool     _cp437;        // If set, use correct CP437 charset (default is ON)
   bool     _utf8;         // If set, use UTF-8 decoder in print stream 'write()' function (default ON)
   bool     _psram_enable; // Enable PSRAM use for library functions (TBD) and Sprites
+  bool     _spritePool;   // Take Sprite memory from the Sprite memory pool, see createSpritePool()
 
   uint32_t _lastColor; // Buffered value of last colour used
 
@@ -783,6 +853,15 @@ class TFT_eSPI : public Print {
   #include "Extensions/Smooth_font.h"  // Loaded if SMOOTH_FONT is defined by user
 #endif
 
+// Load the display list extension
+#include "Extensions/DisplayList.h"
+
+// Load the shape span cache extension
+#include "Extensions/SpanCache.h"
+
+// Load the Sprite layers extension
+#include "Extensions/Layers.h"
+
 }; // End of class TFT_eSPI
 
 /***************************************************************************************
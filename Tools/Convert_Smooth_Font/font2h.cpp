@@ -0,0 +1,425 @@
+/***************************************************************************************
+// Smooth font compiler for TFT_eSPI, runs on a host PC.
+
+// Compiles a subset of the glyphs in a vlw font, or in a TrueType/OpenType font rendered
+// with FreeType, into a C++ header of constexpr tables: the glyph codes sorted for binary
+// search, the glyph metrics and the packed alpha bitmaps. The font is used straight from
+// the tables with no file system and no parse when it is loaded:
+
+//   #include "NotoSansBold15.h"
+//   TFT_eSPI_SmoothFont font(NotoSansBold15);
+//   tft.setFont(&font);
+
+// Build (Linux):
+//   g++ -O2 -o font2h font2h.cpp $(pkg-config --cflags --libs freetype2)
+// or, for vlw fonts only with no FreeType:
+//   g++ -O2 -DNO_FREETYPE -o font2h font2h.cpp
+
+// Usage:
+//   font2h [options] font.vlw|font.ttf header.h
+//     -s pixels   size to render a TrueType font at, required for a TrueType font
+//     -c text     characters to include, UTF-8
+//     -r ranges   Unicode ranges to include, e.g. 0x20-0x7E,0xB0,0x2103
+//     -f file     include the characters in a UTF-8 text file, e.g. the product strings
+//     -n name     name of the font in the header, default is the header file name
+//     -4, -2      store the bitmaps at 4 or 2 bits per pixel, 8 by default
+//   -c, -r and -f can be combined. With none of them all the glyphs of a vlw font are
+//   included, or printable ASCII (0x20-0x7E) from a TrueType font.
+***************************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifndef NO_FREETYPE
+  #include <ft2build.h>
+  #include FT_FREETYPE_H
+#endif
+
+struct Glyph
+{
+  uint16_t code;
+  uint8_t  height, width, xAdvance;
+  int16_t  dY;
+  int8_t   dX;
+  std::vector<uint8_t> alpha;    // 8 bit alpha, width x height
+};
+
+struct Font
+{
+  uint16_t height;               // Font size
+  int16_t  ascent, descent;      // Top of "d" and bottom of "p"
+  std::vector<Glyph> glyphs;
+};
+
+static void fail(const char *message, const char *detail = "")
+{
+  fprintf(stderr, "font2h: %s%s\n", message, detail);
+  exit(1);
+}
+
+
+/***************************************************************************************
+** Function name:           readFile
+** Description:             Read a whole file
+*************************************************************************************x*/
+static std::vector<uint8_t> readFile(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f) fail("cannot open ", path);
+
+  std::vector<uint8_t> data;
+  uint8_t buffer[4096];
+  size_t  n;
+  while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) data.insert(data.end(), buffer, buffer + n);
+  fclose(f);
+  return data;
+}
+
+
+/***************************************************************************************
+** Function name:           addUTF8
+** Description:             Add the characters of a UTF-8 string to the set
+*************************************************************************************x*/
+static void addUTF8(std::vector<bool> &wanted, const std::string &text)
+{
+  for (size_t i = 0; i < text.size(); )
+  {
+    uint8_t  c = text[i];
+    uint32_t code;
+    size_t   n;
+
+    if (c < 0x80)                { code = c;        n = 1; }
+    else if ((c & 0xE0) == 0xC0) { code = c & 0x1F; n = 2; }
+    else if ((c & 0xF0) == 0xE0) { code = c & 0x0F; n = 3; }
+    else if ((c & 0xF8) == 0xF0) { code = c & 0x07; n = 4; }
+    else { i++; continue; }      // Not the start of a character
+
+    if (i + n > text.size()) break;
+    for (size_t k = 1; k < n; k++) code = (code << 6) | (text[i + k] & 0x3F);
+    i += n;
+
+    // Smooth fonts hold the Basic Multilingual Plane, control characters are not drawn
+    if (code > 0xFFFF) fprintf(stderr, "font2h: U+%X is outside the BMP, skipped\n", code);
+    else if (code >= 0x20) wanted[code] = true;
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           addRanges
+** Description:             Add ranges such as 0x20-0x7E,0xB0 to the set
+*************************************************************************************x*/
+static void addRanges(std::vector<bool> &wanted, const char *ranges)
+{
+  const char *p = ranges;
+  while (*p)
+  {
+    char *end;
+    unsigned long first = strtoul(p, &end, 0);
+    unsigned long last  = first;
+    if (end == p) fail("bad range list ", ranges);
+    if (*end == '-') {
+      p = end + 1;
+      last = strtoul(p, &end, 0);
+      if (end == p) fail("bad range list ", ranges);
+    }
+    if (last > 0xFFFF || first > last) fail("bad range ", ranges);
+    for (unsigned long code = first; code <= last; code++) wanted[code] = true;
+
+    p = end;
+    if (*p == ',') p++;
+    else if (*p) fail("bad range list ", ranges);
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           readVLW
+** Description:             Get the glyphs of a vlw font
+*************************************************************************************x*/
+static Font readVLW(const std::vector<uint8_t> &vlw, const std::vector<bool> *wanted)
+{
+  // Big endian 32 bit values, as TFT_eSPI_SmoothFont::readInt32()
+  auto int32 = [&vlw](size_t pos) {
+    return (uint32_t)vlw[pos] << 24 | vlw[pos + 1] << 16 | vlw[pos + 2] << 8 | vlw[pos + 3];
+  };
+
+  if (vlw.size() < 24) fail("not a vlw font");
+
+  Font font;
+  uint16_t count = int32(0);
+  font.height  = int32(8);
+  font.ascent  = int32(16);
+  font.descent = int32(20);
+
+  size_t bitmap = 24 + (size_t)count * 28;
+  for (uint16_t g = 0; g < count; g++)
+  {
+    size_t pos = 24 + g * 28;
+    if (pos + 28 > vlw.size()) fail("vlw font is truncated");
+
+    Glyph glyph;
+    glyph.code     = int32(pos);
+    glyph.height   = int32(pos + 4);
+    glyph.width    = int32(pos + 8);
+    glyph.xAdvance = int32(pos + 12);
+    glyph.dY       = int32(pos + 16);
+    glyph.dX       = int32(pos + 20);
+
+    size_t size = glyph.width * glyph.height;
+    if (bitmap + size > vlw.size()) fail("vlw font is truncated");
+    glyph.alpha.assign(vlw.begin() + bitmap, vlw.begin() + bitmap + size);
+    bitmap += size;
+
+    if (!wanted || (*wanted)[glyph.code]) font.glyphs.push_back(glyph);
+  }
+  return font;
+}
+
+
+#ifndef NO_FREETYPE
+/***************************************************************************************
+** Function name:           renderGlyph
+** Description:             Render a glyph with FreeType, returns false if it is not in the font
+*************************************************************************************x*/
+static bool renderGlyph(FT_Face face, uint16_t code, Glyph &glyph)
+{
+  FT_UInt index = FT_Get_Char_Index(face, code);
+  if (!index || FT_Load_Glyph(face, index, FT_LOAD_RENDER | FT_LOAD_TARGET_NORMAL)) return false;
+
+  FT_GlyphSlot slot = face->glyph;
+  FT_Bitmap   &bm   = slot->bitmap;
+  if (bm.pixel_mode != FT_PIXEL_MODE_GRAY) return false;
+  if (bm.width > 255 || bm.rows > 255) fail("glyph is too large, reduce the size");
+
+  glyph.code     = code;
+  glyph.height   = bm.rows;
+  glyph.width    = bm.width;
+  glyph.xAdvance = std::min(255L, (slot->advance.x + 32) >> 6);
+  glyph.dY       = slot->bitmap_top;
+  glyph.dX       = std::max(-128, std::min(127, slot->bitmap_left));
+
+  glyph.alpha.resize(bm.width * bm.rows);
+  for (unsigned y = 0; y < bm.rows; y++)
+    memcpy(&glyph.alpha[y * bm.width], bm.buffer + (int)y * bm.pitch, bm.width);
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           readTrueType
+** Description:             Render the glyphs of a TrueType or OpenType font
+*************************************************************************************x*/
+static Font readTrueType(const char *path, uint16_t size, const std::vector<bool> &wanted)
+{
+  FT_Library library;
+  FT_Face    face;
+  if (FT_Init_FreeType(&library)) fail("cannot start FreeType");
+  if (FT_New_Face(library, path, 0, &face)) fail("cannot open font ", path);
+  if (FT_Set_Pixel_Sizes(face, 0, size)) fail("font cannot be rendered at the size given");
+
+  Font font;
+  font.height = size;
+
+  // The Processing sketch that makes vlw fonts measures the ascent and descent this way
+  Glyph glyph;
+  font.ascent  = renderGlyph(face, 'd', glyph) ? glyph.dY : face->size->metrics.ascender >> 6;
+  font.descent = renderGlyph(face, 'p', glyph) ? glyph.height - glyph.dY : -(face->size->metrics.descender >> 6);
+
+  for (uint32_t code = 0; code <= 0xFFFF; code++)
+  {
+    if (!wanted[code]) continue;
+    if (renderGlyph(face, code, glyph)) font.glyphs.push_back(glyph);
+    else fprintf(stderr, "font2h: U+%04X is not in the font, skipped\n", code);
+  }
+
+  FT_Done_Face(face);
+  FT_Done_FreeType(library);
+  return font;
+}
+#endif
+
+
+/***************************************************************************************
+** Function name:           writeArray
+** Description:             Write the values of a table, 16 to a line
+*************************************************************************************x*/
+template <typename T> static void writeArray(FILE *out, const char *type, const std::string &name,
+                                            const char *memory, const std::vector<T> &values)
+{
+  fprintf(out, "constexpr %s %s[] %s = {", type, name.c_str(), memory);
+  for (size_t i = 0; i < values.size(); i++)
+    fprintf(out, "%s%ld,", (i % 16) ? " " : "\n  ", (long)values[i]);
+  fprintf(out, "\n};\n\n");
+}
+
+
+int main(int argc, char **argv)
+{
+  const char *size = NULL, *ranges = NULL, *textFile = NULL, *text = NULL, *name = NULL;
+  uint8_t bpp = 8;
+  std::vector<const char *> files;
+
+  for (int i = 1; i < argc; i++)
+  {
+    std::string arg = argv[i];
+    bool value = (i + 1 < argc);
+    if (arg == "-4" || arg == "-2") bpp = arg[1] - '0';
+    else if (arg == "-s" && value) size = argv[++i];
+    else if (arg == "-c" && value) text = argv[++i];
+    else if (arg == "-r" && value) ranges = argv[++i];
+    else if (arg == "-f" && value) textFile = argv[++i];
+    else if (arg == "-n" && value) name = argv[++i];
+    else if (arg[0] == '-') { files.clear(); break; } // Show the usage
+    else files.push_back(argv[i]);
+  }
+
+  if (files.size() != 2) {
+    fprintf(stderr, "Usage: font2h [-s pixels] [-c text] [-r ranges] [-f file] [-n name] [-4|-2] font.vlw|font.ttf header.h\n");
+    return 1;
+  }
+
+  // Characters to include
+  std::vector<bool> wanted(0x10000, false);
+  bool subset = text || ranges || textFile;
+  if (text) addUTF8(wanted, text);
+  if (ranges) addRanges(wanted, ranges);
+  if (textFile) {
+    std::vector<uint8_t> data = readFile(textFile);
+    addUTF8(wanted, std::string(data.begin(), data.end()));
+  }
+
+  std::string source = files[0];
+  std::string extension = source.substr(source.find_last_of('.') + 1);
+  std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+  Font font;
+  if (extension == "vlw") font = readVLW(readFile(files[0]), subset ? &wanted : NULL);
+  else
+  {
+#ifdef NO_FREETYPE
+    (void)size;
+    fail("built without FreeType, only vlw fonts can be compiled");
+#else
+    if (!size || atoi(size) < 1) fail("a TrueType font needs a size, -s pixels");
+    if (!subset) addRanges(wanted, "0x20-0x7E");
+    font = readTrueType(files[0], atoi(size), wanted);
+#endif
+  }
+  if (font.glyphs.empty()) fail("no glyphs to compile");
+
+  // Same processing of the glyph metrics as TFT_eSPI_SmoothFont::loadMetrics()
+  uint16_t maxAscent  = font.ascent;
+  uint16_t maxDescent = font.descent;
+  uint16_t yAdvance   = font.ascent + font.descent;
+  uint16_t spaceWidth = yAdvance / 4;
+
+  for (Glyph &glyph : font.glyphs)
+  {
+    if (glyph.code == 0x20) spaceWidth = glyph.xAdvance;
+    if (glyph.dY > (int16_t)maxAscent && glyph.code > 0x20 && glyph.code != 0xA0) maxAscent = glyph.dY;
+    if (glyph.dY > (int16_t)font.height) glyph.dY = font.height;
+    if (glyph.height - glyph.dY > (int16_t)maxDescent && glyph.code > 0x20 && glyph.code != 0xA0) maxDescent = glyph.height - glyph.dY;
+    yAdvance = maxAscent + maxDescent;
+  }
+
+  // Sorted by Unicode for binary search, repeated codes keep font order so lookups find the same glyph
+  std::stable_sort(font.glyphs.begin(), font.glyphs.end(),
+                   [](const Glyph &a, const Glyph &b) { return a.code < b.code; });
+
+  uint16_t count = font.glyphs.size();
+  uint16_t maxAdvance = 0, maxSize = 0;
+
+  std::vector<uint32_t> offset;
+  std::vector<uint16_t> unicode;
+  std::vector<int16_t>  dY;
+  std::vector<uint8_t>  height, width, xAdvance;
+  std::vector<int8_t>   dX;
+  std::vector<uint8_t>  bitmaps;
+  std::vector<uint32_t> bitmapEnd;
+
+  for (const Glyph &glyph : font.glyphs)
+  {
+    maxAdvance = std::max<uint16_t>(maxAdvance, glyph.xAdvance);
+    maxSize    = std::max<uint16_t>(maxSize, glyph.width * glyph.height);
+
+    offset.push_back(bitmaps.size());
+    unicode.push_back(glyph.code);
+    dY.push_back(glyph.dY);
+    height.push_back(glyph.height);
+    width.push_back(glyph.width);
+    xAdvance.push_back(glyph.xAdvance);
+    dX.push_back(glyph.dX);
+
+    // Nearest level, packed high bits first with no padding at the end of a row
+    if (bpp == 8) bitmaps.insert(bitmaps.end(), glyph.alpha.begin(), glyph.alpha.end());
+    else
+    {
+      size_t   at = bitmaps.size();
+      uint16_t levels = (1 << bpp) - 1;
+      bitmaps.resize(at + (glyph.alpha.size() * bpp + 7) / 8, 0);
+      for (size_t i = 0; i < glyph.alpha.size(); i++) {
+        size_t bit = i * bpp;
+        bitmaps[at + bit / 8] |= ((glyph.alpha[i] * levels + 127) / 255) << (8 - bpp - bit % 8);
+      }
+    }
+    bitmapEnd.push_back(bitmaps.size());
+  }
+
+  // Font name from the header file name unless given
+  std::string header = files[1];
+  std::string font_name = name ? name : header.substr(header.find_last_of('/') + 1);
+  if (!name) font_name = font_name.substr(0, font_name.find_last_of('.'));
+  for (char &c : font_name) if (!isalnum((uint8_t)c)) c = '_';
+  if (isdigit((uint8_t)font_name[0])) font_name = "_" + font_name;
+
+  FILE *out = fopen(files[1], "w");
+  if (!out) fail("cannot create ", files[1]);
+
+  std::string sourceName = source.substr(source.find_last_of('/') + 1);
+  fprintf(out, "// Smooth font compiled by font2h from %s, %u glyphs at %u bits per pixel\n", sourceName.c_str(), count, bpp);
+  fprintf(out, "// %zu bytes of bitmaps and %u bytes of metrics in flash. Use with:\n", bitmaps.size(), count * 12);
+  fprintf(out, "//   TFT_eSPI_SmoothFont font(%s);\n", font_name.c_str());
+  fprintf(out, "//   tft.setFont(&font);\n\n");
+  fprintf(out, "#pragma once\n#include <TFT_eSPI.h>\n\n");
+
+  writeArray(out, "uint32_t", font_name + "_bitmap",   "SMOOTH_FONT_TABLE", offset);
+  writeArray(out, "uint16_t", font_name + "_unicode",  "SMOOTH_FONT_TABLE", unicode);
+  writeArray(out, "int16_t",  font_name + "_dY",       "SMOOTH_FONT_TABLE", dY);
+  writeArray(out, "uint8_t",  font_name + "_height",   "SMOOTH_FONT_TABLE", height);
+  writeArray(out, "uint8_t",  font_name + "_width",    "SMOOTH_FONT_TABLE", width);
+  writeArray(out, "uint8_t",  font_name + "_xAdvance", "SMOOTH_FONT_TABLE", xAdvance);
+  writeArray(out, "int8_t",   font_name + "_dX",       "SMOOTH_FONT_TABLE", dX);
+
+  // Bitmaps a glyph at a time so they can be found, an array cannot be empty
+  fprintf(out, "constexpr uint8_t %s_bitmaps[] PROGMEM = {\n", font_name.c_str());
+  for (uint16_t g = 0; g < count; g++)
+  {
+    if (offset[g] == bitmapEnd[g]) continue;
+    fprintf(out, "  // U+%04X", unicode[g]);
+    if (unicode[g] > 0x20 && unicode[g] < 0x7F) fprintf(out, " '%c'", unicode[g]);
+    for (uint32_t i = offset[g]; i < bitmapEnd[g]; i++)
+      fprintf(out, "%s0x%02X,", ((i - offset[g]) % 16) ? " " : "\n  ", bitmaps[i]);
+    fprintf(out, "\n");
+  }
+  if (bitmaps.empty()) fprintf(out, "  0x00\n");
+  fprintf(out, "};\n\n");
+
+  fprintf(out, "constexpr TFT_eSPI_SmoothFont::compiledFont %s = {\n", font_name.c_str());
+  fprintf(out, "  { %u, %u, %u, %u, %d, %d, %u, %u }, // gCount, height, yAdvance, spaceWidth, ascent, descent, maxAscent, maxDescent\n",
+          count, font.height, yAdvance, spaceWidth, font.ascent, font.descent, maxAscent, maxDescent);
+  fprintf(out, "  %u, %u, %u, // maxAdvance, maxSize, bpp\n", maxAdvance, maxSize, bpp);
+  const char *tables[] = { "bitmap", "unicode", "dY", "height", "width", "xAdvance", "dX", "bitmaps" };
+  for (const char *table : tables)
+    fprintf(out, "  %s_%s,\n", font_name.c_str(), table);
+  fprintf(out, "};\n");
+  fclose(out);
+
+  printf("%s: %u glyphs, %zu bitmap bytes, %u bpp\n", files[1], count, bitmaps.size(), bpp);
+  return 0;
+}
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""
+Convert a smooth font vlw file into an indexed font (.vli) for TFT_eSPI.
+
+The indexed font holds the glyph metrics already processed and sorted by
+Unicode, so TFT_eSPI_SmoothFont loads it from a file with one read, or uses
+it in place from a PROGMEM array, with no parse of the glyph records.
+The format is described in loadIndex() in Extensions/SmoothFont.cpp.
+
+Usage:
+    python3 vlw2vli.py [-4|-2] NotoSansBold15.vlw [NotoSansBold15.vli]
+    python3 vlw2vli.py [-4|-2] NotoSansBold15.vlw NotoSansBold15.h
+
+    -4      store the bitmaps at 4 bits per pixel (16 grey levels), about half the size
+    -2      store the bitmaps at 2 bits per pixel (4 grey levels), about a quarter the size
+    .h      output a header with the font as a PROGMEM array, used with:
+                #include "NotoSansBold15.h"
+                TFT_eSPI_SmoothFont font(NotoSansBold15);
+                tft.setFont(&font);
+"""
+
+import os
+import struct
+import sys
+
+
+def s8(v):
+    v &= 0xFF
+    return v - 0x100 if v & 0x80 else v
+
+
+def s16(v):
+    v &= 0xFFFF
+    return v - 0x10000 if v & 0x8000 else v
+
+
+def convert(vlw, bpp):
+    count, _, height, _, ascent, descent = struct.unpack_from(">6I", vlw, 0)
+    count &= 0xFFFF
+    height &= 0xFFFF
+    ascent = s16(ascent)
+    descent = s16(descent)
+
+    # Same processing of the glyph records as TFT_eSPI_SmoothFont::loadMetrics()
+    max_ascent = ascent & 0xFFFF
+    max_descent = descent & 0xFFFF
+    y_advance = (ascent + descent) & 0xFFFF
+    space_width = y_advance // 4
+
+    glyphs = []
+    bitmap = 24 + count * 28
+    for g in range(count):
+        code, h, w, adv, dy, dx, _ = struct.unpack_from(">7I", vlw, 24 + g * 28)
+        code &= 0xFFFF
+        h &= 0xFF
+        w &= 0xFF
+        adv &= 0xFF
+        dy = s16(dy)
+        dx = s8(dx)
+
+        if code == 0x20:
+            space_width = adv
+        if dy > max_ascent and code > 0x20 and code != 0xA0:
+            max_ascent = dy
+        if dy > height:
+            dy = height
+        if h - dy > max_descent and code > 0x20 and code != 0xA0:
+            max_descent = (h - dy) & 0xFFFF
+        y_advance = (max_ascent + max_descent) & 0xFFFF
+
+        glyphs.append((code, g, h, w, adv, dy, dx, vlw[bitmap:bitmap + w * h]))
+        bitmap += w * h
+
+    # Sorted by Unicode, repeated codes keep file order so lookups find the same glyph
+    glyphs.sort(key=lambda glyph: (glyph[0], glyph[1]))
+
+    max_advance = max([glyph[4] for glyph in glyphs] + [0])
+    max_size = max([glyph[2] * glyph[3] for glyph in glyphs] + [0])
+
+    header = b"VLI\x01" + struct.pack("<HHhhHHHHHHB3x", count, height, ascent, descent,
+                                      max_ascent, max_descent, y_advance, space_width,
+                                      max_advance, max_size, bpp)
+
+    offset = len(header) + count * 12
+    offset += -offset % 4
+    offsets = []
+    bitmaps = bytearray()
+    for glyph in glyphs:
+        pixels = glyph[7]
+        if bpp < 8:
+            # Nearest level, packed high bits first with no padding at the end of a row
+            levels = (1 << bpp) - 1
+            packed = bytearray((len(pixels) * bpp + 7) // 8)
+            for i, alpha in enumerate(pixels):
+                bit = i * bpp
+                packed[bit // 8] |= ((alpha * levels + 127) // 255) << (8 - bpp - bit % 8)
+            pixels = packed
+        offsets.append(offset + len(bitmaps))
+        bitmaps += pixels
+
+    out = bytearray(header)
+    out += struct.pack("<%dI" % count, *offsets)
+    out += struct.pack("<%dH" % count, *[glyph[0] for glyph in glyphs])
+    out += struct.pack("<%dh" % count, *[glyph[5] for glyph in glyphs])
+    out += bytes(glyph[2] for glyph in glyphs)
+    out += bytes(glyph[3] for glyph in glyphs)
+    out += bytes(glyph[4] for glyph in glyphs)
+    out += bytes(glyph[6] & 0xFF for glyph in glyphs)
+    out += bytes(-len(out) % 4)
+    out += bitmaps
+    return out
+
+
+def write_header(path, data):
+    name = os.path.splitext(os.path.basename(path))[0].replace("-", "_").replace(" ", "_")
+    with open(path, "w") as f:
+        f.write("// Indexed smooth font made by vlw2vli.py, use with:\n")
+        f.write("//   TFT_eSPI_SmoothFont font(%s);\n\n" % name)
+        f.write("#include <pgmspace.h>\n\n")
+        f.write("// Must be 4 byte aligned for the metrics to be used in place\n")
+        f.write("alignas(4) const uint8_t %s[] PROGMEM = {\n" % name)
+        for i in range(0, len(data), 16):
+            f.write(" ".join("0x%02X," % b for b in data[i:i + 16]) + "\n")
+        f.write("};\n")
+
+
+def main(argv):
+    bpp = 8
+    for option in ("-4", "-2"):
+        if option in argv:
+            bpp = int(option[1])
+            argv.remove(option)
+    if len(argv) not in (1, 2):
+        sys.exit(__doc__)
+
+    source = argv[0]
+    target = argv[1] if len(argv) == 2 else os.path.splitext(source)[0] + ".vli"
+
+    with open(source, "rb") as f:
+        data = convert(f.read(), bpp)
+
+    if target.endswith(".h"):
+        write_header(target, data)
+    else:
+        with open(target, "wb") as f:
+            f.write(data)
+
+    print("%s: %d bytes, %d bpp" % (target, len(data), bpp))
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
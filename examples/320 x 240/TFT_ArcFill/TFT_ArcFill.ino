@@ -62,37 +62,25 @@ void loop() {
 int fillArc(int x, int y, int start_angle, int seg_count, int rx, int ry, int w, unsigned int colour)
 {
 
-  byte seg = 6; // Segments are 3 degrees wide = 120 segments for 360 degrees
-  byte inc = 6; // Draw segments every 3 degrees, increase to 6 for segmented ring
-
-  // Calculate first pair of coordinates for segment start
-  float sx = cos((start_angle - 90) * DEG2RAD);
-  float sy = sin((start_angle - 90) * DEG2RAD);
-  uint16_t x0 = sx * (rx - w) + x;
-  uint16_t y0 = sy * (ry - w) + y;
-  uint16_t x1 = sx * rx + x;
-  uint16_t y1 = sy * ry + y;
-
-  // Draw colour blocks every inc degrees
-  for (int i = start_angle; i < start_angle + seg * seg_count; i += inc) {
-
-    // Calculate pair of coordinates for segment end
-    float sx2 = cos((i + seg - 90) * DEG2RAD);
-    float sy2 = sin((i + seg - 90) * DEG2RAD);
-    int x2 = sx2 * (rx - w) + x;
-    int y2 = sy2 * (ry - w) + y;
-    int x3 = sx2 * rx + x;
-    int y3 = sy2 * ry + y;
-
-    tft.fillTriangle(x0, y0, x1, y1, x2, y2, colour);
-    tft.fillTriangle(x1, y1, x2, y2, x3, y3, colour);
-
-    // Copy segment end to sgement start for next segment
-    x0 = x2;
-    y0 = y2;
-    x1 = x3;
-    y1 = y3;
+  byte seg = 6; // Segments are 6 degrees wide = 60 segments for 360 degrees
+
+  if (seg_count > 60) seg_count = 60;
+
+  // The arc is filled as one polygon, along the outer edge then back along the inner edge
+  int16_t xy[4 * 61];
+  uint16_t n = 0;
+
+  for (int i = 0; i <= seg_count; i++) {
+    xy[n++] = cos((start_angle + i * seg - 90) * DEG2RAD) * rx + x;
+    xy[n++] = sin((start_angle + i * seg - 90) * DEG2RAD) * ry + y;
   }
+
+  for (int i = seg_count; i >= 0; i--) {
+    xy[n++] = cos((start_angle + i * seg - 90) * DEG2RAD) * (rx - w) + x;
+    xy[n++] = sin((start_angle + i * seg - 90) * DEG2RAD) * (ry - w) + y;
+  }
+
+  tft.fillPolygon(xy, n / 2, colour);
 }
 
 // #########################################################################
@@ -76,8 +76,9 @@ int fillArc(int x, int y, int start_angle, int seg_count, int rx, int ry, int w,
     int x3 = sx2 * rx + x;
     int y3 = sy2 * ry + y;
 
-    tft.fillTriangle(x0, y0, x1, y1, x2, y2, colour);
-    tft.fillTriangle(x1, y1, x2, y2, x3, y3, colour);
+    // Fill the segment as one polygon, round the outer edge and back along the inner edge
+    int16_t xy[8] = { (int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1, (int16_t)x3, (int16_t)y3, (int16_t)x2, (int16_t)y2 };
+    tft.fillPolygon(xy, 4, colour);
   }
 }
 
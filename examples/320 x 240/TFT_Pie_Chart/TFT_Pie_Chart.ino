@@ -48,25 +48,19 @@ void loop() {
 
 int fillSegment(int x, int y, int start_angle, int sub_angle, int r, unsigned int colour)
 {
-  // Calculate first pair of coordinates for segment start
-  float sx = cos((start_angle - 90) * DEG2RAD);
-  float sy = sin((start_angle - 90) * DEG2RAD);
-  uint16_t x1 = sx * r + x;
-  uint16_t y1 = sy * r + y;
+  // The segment is filled as one polygon, the centre then a point on the edge every degree
+  int16_t xy[2 * 362];
+  uint16_t n = 0;
 
-  // Draw colour blocks every inc degrees
-  for (int i = start_angle; i < start_angle + sub_angle; i++) {
+  xy[n++] = x;
+  xy[n++] = y;
 
-    // Calculate pair of coordinates for segment end
-    int x2 = cos((i + 1 - 90) * DEG2RAD) * r + x;
-    int y2 = sin((i + 1 - 90) * DEG2RAD) * r + y;
-
-    tft.fillTriangle(x1, y1, x2, y2, x, y, colour);
-
-    // Copy segment end to sgement start for next segment
-    x1 = x2;
-    y1 = y2;
+  for (int i = start_angle; i <= start_angle + sub_angle; i++) {
+    xy[n++] = cos((i - 90) * DEG2RAD) * r + x;
+    xy[n++] = sin((i - 90) * DEG2RAD) * r + y;
   }
+
+  tft.fillPolygon(xy, n / 2, colour);
 }
 
 
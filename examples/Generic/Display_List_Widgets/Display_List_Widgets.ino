@@ -0,0 +1,76 @@
+/*
+  Draws a panel of gauge widgets, each made of a few dozen rectangles, lines
+  and circles, first directly and then recorded in a display list.
+
+  While the display list is recording, drawPixel(), drawFastHLine(),
+  drawFastVLine() and fillRect() calls are kept in RAM. When the list is
+  flushed, fills of the same colour that touch are merged, fills that are
+  later drawn over are removed, and the rest are sent to the TFT in one
+  transaction. The screen looks the same but far fewer commands are sent.
+
+  The drawing times and the display list statistics are printed to the
+  Serial Monitor.
+*/
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI tft = TFT_eSPI();
+
+void drawGauge(int32_t x, int32_t y, uint8_t percent, uint16_t colour)
+{
+  tft.fillRoundRect(x, y, 140, 60, 10, TFT_DARKGREY);
+  tft.drawRoundRect(x, y, 140, 60, 10, TFT_WHITE);
+
+  // Bar, background then the level drawn over it
+  tft.fillRect(x + 10, y + 10, 120, 12, TFT_BLACK);
+  tft.fillRect(x + 10, y + 10, 120 * percent / 100, 12, colour);
+
+  // Scale ticks
+  for (int32_t i = 0; i <= 12; i++) tft.drawFastVLine(x + 10 + i * 10, y + 24, (i % 4) ? 4 : 8, TFT_WHITE);
+
+  // Status lamp
+  tft.fillCircle(x + 25, y + 45, 8, colour);
+  tft.drawCircle(x + 25, y + 45, 8, TFT_WHITE);
+
+  tft.drawLine(x + 45, y + 52, x + 45 + percent, y + 36, TFT_YELLOW);
+}
+
+void drawPanel(void)
+{
+  for (uint8_t i = 0; i < 6; i++) {
+    drawGauge((i % 2) * 160 + 10, (i / 2) * 75 + 10, random(101), random(0x10000));
+  }
+}
+
+void setup(void)
+{
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+}
+
+void loop()
+{
+  randomSeed(1);
+  uint32_t t = micros();
+  drawPanel();
+  uint32_t directTime = micros() - t;
+
+  delay(1000);
+
+  randomSeed(1);
+  t = micros();
+  tft.startDisplayList();
+  drawPanel();
+  tft.endDisplayList();
+  uint32_t listTime = micros() - t;
+
+  Serial.printf("Direct %lu us, display list %lu us\r\n", (unsigned long)directTime, (unsigned long)listTime);
+  Serial.printf("Recorded %lu, merged %lu, dropped %lu, drawn %lu\r\n", (unsigned long)tft.dlStats.recorded,
+                (unsigned long)tft.dlStats.merged, (unsigned long)tft.dlStats.dropped, (unsigned long)tft.dlStats.drawn);
+
+  delay(1000);
+}
@@ -0,0 +1,114 @@
+/*
+  Line drawing benchmark, based on the line test of TFT_graphicstest.
+
+  Fans of lines are drawn from each corner of the screen, first one line at a
+  time with drawLine() and then all the lines of a fan in one drawLines() call.
+  A chart trace is then drawn with drawLine() for each point and with a single
+  drawPolyline() call.
+
+  drawLine() sends the runs of pixels of a line that is all on the screen
+  without clipping each one, and the address commands are only sent when the
+  column or row range changes. drawLines() and drawPolyline() also keep the
+  TFT selected for the whole batch.
+
+  The times and the address command bytes sent are printed to the Serial
+  Monitor.
+*/
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI tft = TFT_eSPI();
+
+#define FAN_LINES 140       // Enough for a fan across a 480 x 320 screen
+
+int16_t fan[FAN_LINES * 4];  // x0, y0, x1, y1 for each line
+int16_t trace[240 * 2];      // x, y for each point
+
+uint32_t addrBytes;          // Address command bytes sent by the last test
+
+// Make the lines of the fan from one corner, as drawn by TFT_graphicstest
+uint16_t makeFan(int16_t x1, int16_t y1)
+{
+  int16_t w = tft.width(), h = tft.height();
+  uint16_t n = 0;
+
+  for (int16_t x2 = 0; (x2 < w) && (n < FAN_LINES); x2 += 6, n++) {
+    fan[n * 4] = x1; fan[n * 4 + 1] = y1; fan[n * 4 + 2] = x2; fan[n * 4 + 3] = h - 1 - y1;
+  }
+  for (int16_t y2 = 0; (y2 < h) && (n < FAN_LINES); y2 += 6, n++) {
+    fan[n * 4] = x1; fan[n * 4 + 1] = y1; fan[n * 4 + 2] = w - 1 - x1; fan[n * 4 + 3] = y2;
+  }
+
+  return n;
+}
+
+// Time the four fans, batched or one line at a time
+uint32_t testFans(bool batch, uint16_t color)
+{
+  uint32_t t = 0;
+  addrBytes = 0;
+
+  for (uint8_t corner = 0; corner < 4; corner++) {
+    tft.fillScreen(TFT_BLACK);
+
+    uint16_t lines = makeFan((corner & 1) ? tft.width() - 1 : 0, (corner & 2) ? tft.height() - 1 : 0);
+
+    uint32_t sent = tft.winStats.sent;
+    uint32_t start = micros();
+    if (batch) tft.drawLines(fan, lines, color);
+    else for (uint16_t i = 0; i < lines; i++) tft.drawLine(fan[i * 4], fan[i * 4 + 1], fan[i * 4 + 2], fan[i * 4 + 3], color);
+    t += micros() - start;
+    addrBytes += tft.winStats.sent - sent;
+  }
+
+  return t;
+}
+
+// Time a chart trace, batched or one line at a time
+uint32_t testTrace(bool batch, uint16_t color)
+{
+  tft.fillScreen(TFT_BLACK);
+
+  uint16_t points = min(tft.width(), (int16_t)240);
+  for (uint16_t i = 0; i < points; i++) {
+    trace[i * 2] = i;
+    trace[i * 2 + 1] = tft.height() / 2 + (tft.height() / 3) * sin(i / 12.0) * cos(i / 47.0);
+  }
+
+  uint32_t sent = tft.winStats.sent;
+  uint32_t start = micros();
+  if (batch) tft.drawPolyline(trace, points, color);
+  else for (uint16_t i = 1; i < points; i++) tft.drawLine(trace[i * 2 - 2], trace[i * 2 - 1], trace[i * 2], trace[i * 2 + 1], color);
+
+  uint32_t t = micros() - start;
+  addrBytes = tft.winStats.sent - sent;
+
+  return t;
+}
+
+void report(const char* name, uint32_t t)
+{
+  Serial.printf("%-24s %10lu %14lu\r\n", name, (unsigned long)t, (unsigned long)addrBytes);
+}
+
+void setup(void)
+{
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+}
+
+void loop()
+{
+  Serial.println(F("Benchmark                     Time (us)  Address bytes"));
+
+  report("Lines, drawLine()", testFans(false, TFT_CYAN));
+  report("Lines, drawLines()", testFans(true, TFT_CYAN));
+  report("Trace, drawLine()", testTrace(false, TFT_YELLOW));
+  report("Trace, drawPolyline()", testTrace(true, TFT_YELLOW));
+
+  Serial.println();
+  delay(5000);
+}
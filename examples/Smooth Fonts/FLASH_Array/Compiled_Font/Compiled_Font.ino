@@ -0,0 +1,60 @@
+/*
+  Shows a smooth font compiled into the sketch as constant tables.
+
+  Readout36.h holds only the glyphs this sketch draws, taken from the
+  NotoSansBold36 font. It was made with the font compiler in the Tools folder:
+
+    font2h -4 -c "0123456789.-VAW" NotoSansBold36.vlw Readout36.h
+
+  The glyph metrics and bitmaps are used where they are in flash, so no file
+  system is needed, the font is not parsed when it is loaded and the metrics
+  take no RAM. The bitmaps are stored at 4 bits per pixel to halve their size.
+
+  The font load time and the RAM it uses are printed to the Serial Monitor.
+*/
+
+//  A processing sketch to create new vlw fonts can be found in the Tools folder of TFT_eSPI
+//  https://github.com/Bodmer/TFT_eSPI/tree/master/Tools/Create_Smooth_Font/Create_font
+//  TrueType fonts can be compiled directly, see Tools/Convert_Smooth_Font/font2h.cpp
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+#include "Readout36.h"
+
+TFT_eSPI tft = TFT_eSPI();
+
+TFT_eSPI_SmoothFont readout(Readout36);
+
+float volts = 11.5;
+
+void setup(void) {
+
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+
+  tft.setFont(&readout);
+
+  Serial.printf("Font loaded in %lu us, %u glyphs, %u bytes of drawing RAM\r\n",
+                (unsigned long)readout.loadDuration(), readout.gFont.gCount, (unsigned)readout.metricsSize());
+}
+
+void loop() {
+
+  volts += 0.25;
+  if (volts > 14.5) volts = 11.5;
+
+  tft.setTextColor(TFT_GREEN, TFT_BLACK);
+  tft.setTextDatum(MC_DATUM);
+
+  // Pad to the widest reading so the old digits are overwritten
+  tft.setTextPadding(tft.textWidth("88.88V"));
+
+  tft.drawString(String(volts, 2) + "V", tft.width() / 2, tft.height() / 2 - 30);
+  tft.drawString(String(volts * 0.8, 1) + "W", tft.width() / 2, tft.height() / 2 + 30);
+
+  delay(500);
+}
@@ -0,0 +1,302 @@
+// Smooth font compiled by font2h from NotoSansBold36.vlw, 15 glyphs at 4 bits per pixel
+// 3621 bytes of bitmaps and 180 bytes of metrics in flash. Use with:
+//   TFT_eSPI_SmoothFont font(Readout36);
+//   tft.setFont(&font);
+
+#pragma once
+#include <TFT_eSPI.h>
+
+constexpr uint32_t Readout36_bitmap[] SMOOTH_FONT_TABLE = {
+  0, 25, 50, 316, 485, 742, 1008, 1268, 1511, 1768, 2015, 2272, 2529, 2854, 3166,
+};
+
+constexpr uint16_t Readout36_unicode[] SMOOTH_FONT_TABLE = {
+  45, 46, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 65, 86, 87,
+};
+
+constexpr int16_t Readout36_dY[] SMOOTH_FONT_TABLE = {
+  12, 6, 27, 26, 27, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+};
+
+constexpr uint8_t Readout36_height[] SMOOTH_FONT_TABLE = {
+  5, 7, 28, 26, 27, 28, 26, 27, 27, 26, 27, 27, 26, 26, 26,
+};
+
+constexpr uint8_t Readout36_width[] SMOOTH_FONT_TABLE = {
+  10, 7, 19, 13, 19, 19, 20, 18, 19, 19, 19, 19, 25, 24, 35,
+};
+
+constexpr uint8_t Readout36_xAdvance[] SMOOTH_FONT_TABLE = {
+  12, 10, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 25, 23, 35,
+};
+
+constexpr int8_t Readout36_dX[] SMOOTH_FONT_TABLE = {
+  1, 2, 1, 2, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0,
+};
+
+constexpr uint8_t Readout36_bitmaps[] PROGMEM = {
+  // U+002D '-'
+  0xDD, 0xDD, 0xDD, 0xDD, 0xD8, 0xEF, 0xFF, 0xFF, 0xFF, 0xF9, 0xEF, 0xFF, 0xFF, 0xFF, 0xF9, 0xEF,
+  0xFF, 0xFF, 0xFF, 0xF9, 0x89, 0x99, 0x99, 0x99, 0x95,
+  // U+002E '.'
+  0x02, 0x67, 0x40, 0x05, 0xFF, 0xFF, 0x90, 0xCF, 0xFF, 0xFF, 0x1E, 0xFF, 0xFF, 0xF4, 0xCF, 0xFF,
+  0xFF, 0x14, 0xFF, 0xFF, 0x80, 0x01, 0x56, 0x30, 0x00,
+  // U+0030 '0'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xEF, 0xFF, 0xD8,
+  0x20, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xFF, 0xFE, 0x60, 0x00, 0x00, 0x01, 0xDF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+  0x4F, 0xFF, 0xFF, 0xC6, 0x58, 0xFF, 0xFF, 0xFA, 0x00, 0x09, 0xFF, 0xFF, 0xD1, 0x00, 0x07, 0xFF,
+  0xFF, 0xF1, 0x00, 0xEF, 0xFF, 0xF7, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x60, 0x3F, 0xFF, 0xFF, 0x30,
+  0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x05, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE0, 0x7F,
+  0xFF, 0xFD, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0xF2, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0xA0, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0xF4, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x4A, 0xFF,
+  0xFF, 0xA0, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x9F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xFF, 0x38, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF0, 0x5F, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x5F, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xC0, 0x0E, 0xFF,
+  0xFF, 0x50, 0x00, 0x00, 0xCF, 0xFF, 0xF9, 0x00, 0x9F, 0xFF, 0xFC, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+  0x40, 0x03, 0xFF, 0xFF, 0xF9, 0x20, 0x4E, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x3E,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xFF, 0xFF, 0xD6, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x35, 0x54, 0x10, 0x00, 0x00, 0x00,
+  // U+0031 '1'
+  0x00, 0x00, 0x00, 0x01, 0x9A, 0xAA, 0x90, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFE, 0x00, 0x00, 0x05,
+  0xEF, 0xFF, 0xFF, 0xE0, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x5F, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xE5, 0xFF, 0xFF,
+  0xD2, 0x7F, 0xFF, 0xFE, 0x08, 0xFF, 0xB1, 0x09, 0xFF, 0xFF, 0xE0, 0x0B, 0x80, 0x00, 0x9F, 0xFF,
+  0xFE, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x09, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x09, 0xFF,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x9F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x9F,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x09, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x09,
+  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFE,
+  // U+0032 '2'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7B, 0xEF, 0xFF, 0xEA,
+  0x40, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x4E, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x01,
+  0xCF, 0xFF, 0xFF, 0xA7, 0x7A, 0xFF, 0xFF, 0xFF, 0x40, 0x01, 0xEF, 0xF8, 0x10, 0x00, 0x05, 0xFF,
+  0xFF, 0xF8, 0x00, 0x03, 0xD3, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2E, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xE3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF,
+  0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
+  0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1C, 0xFF, 0xFF, 0xFB, 0x99, 0x99, 0x99, 0x99, 0x99, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF5, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x50,
+  // U+0033 '3'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xBE, 0xFF, 0xFF, 0xC9,
+  0x40, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x05, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0x3F, 0xFF, 0xD8, 0x55, 0x5A, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x8C, 0x40, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x03, 0x44, 0x55, 0x9E, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFD, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF,
+  0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00,
+  0x09, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6D, 0xFF, 0xFF,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x05, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+  0xD0, 0x9F, 0xB7, 0x40, 0x00, 0x02, 0x7E, 0xFF, 0xFF, 0xF8, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x10, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x09, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x06, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x45, 0x55, 0x43, 0x00, 0x00, 0x00, 0x00,
+  // U+0034 '4'
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAA, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D,
+  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0xFE, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF7, 0xFF, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0xFF, 0x95, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFE, 0x15,
+  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF5, 0x05, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0xA0, 0x05, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x10, 0x05, 0xFF, 0xFF,
+  0xE0, 0x00, 0x00, 0x2E, 0xFF, 0xF5, 0x00, 0x05, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0xA0,
+  0x00, 0x05, 0xFF, 0xFF, 0xE0, 0x00, 0x06, 0xFF, 0xFE, 0x10, 0x00, 0x05, 0xFF, 0xFF, 0xE0, 0x00,
+  0x2E, 0xFF, 0xFC, 0x99, 0x99, 0x9B, 0xFF, 0xFF, 0xF9, 0x98, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAC, 0xFF, 0xFF,
+  0xFA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0xFF, 0xE0, 0x00,
+  // U+0035 '5'
+  0x00, 0x7A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x20, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x40, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0x30, 0x02, 0xFF, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xFF, 0xFF, 0x94, 0x55, 0x54, 0x10, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x30, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x0A, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x06, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x16,
+  0x51, 0x00, 0x03, 0x8F, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFB,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xCF, 0xFF, 0xFA, 0x36, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF7, 0x4F, 0xFA, 0x64,
+  0x10, 0x14, 0x9F, 0xFF, 0xFF, 0xF2, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x4F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90,
+  0x00, 0x04, 0xAE, 0xFF, 0xFF, 0xFF, 0xFE, 0x93, 0x00, 0x00, 0x00, 0x00, 0x14, 0x55, 0x54, 0x10,
+  0x00, 0x00, 0x00,
+  // U+0036 '6'
+  0x00, 0x00, 0x00, 0x01, 0x6A, 0xCE, 0xFF, 0xEE, 0x70, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF9, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x4F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFC, 0x85, 0x44, 0x45, 0x50, 0x00,
+  0x0B, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xA0, 0x04, 0x9A, 0xA9, 0x50, 0x00, 0x00, 0x5F,
+  0xFF, 0xF6, 0x1B, 0xFF, 0xFF, 0xFF, 0xE5, 0x00, 0x08, 0xFF, 0xFF, 0x6D, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF7, 0x00, 0x9F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x0A, 0xFF, 0xFF, 0xFF, 0xE9,
+  0x68, 0xDF, 0xFF, 0xFF, 0xB0, 0xAF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x0A, 0xFF,
+  0xFF, 0xF2, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x0E, 0xFF,
+  0xFF, 0x59, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF5, 0x6F, 0xFF, 0xFC, 0x00, 0x00,
+  0x00, 0x0E, 0xFF, 0xFF, 0x53, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x0D, 0xFF,
+  0xFF, 0xA0, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xA2, 0x01, 0x8F, 0xFF, 0xFF,
+  0xA0, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0x7D, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x45, 0x53, 0x00, 0x00, 0x00,
+  0x00,
+  // U+0037 '7'
+  0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xFF, 0xFF, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+  0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1E, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFE,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+  // U+0038 '8'
+  0x00, 0x00, 0x16, 0xAE, 0xFF, 0xFC, 0x94, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x20, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x4F, 0xFF, 0xFF,
+  0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0x00, 0x0A, 0xFF, 0xFF, 0xE5, 0x00, 0x2A, 0xFF, 0xFF, 0xF4, 0x00,
+  0xEF, 0xFF, 0xF6, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x60, 0x0E, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x9F,
+  0xFF, 0xF7, 0x00, 0xCF, 0xFF, 0xF5, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x50, 0x08, 0xFF, 0xFF, 0xC1,
+  0x00, 0x04, 0xFF, 0xFF, 0xF1, 0x00, 0x1E, 0xFF, 0xFF, 0xD4, 0x08, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+  0x4F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x7F,
+  0xFF, 0xFF, 0xA1, 0x1A, 0xFF, 0xFF, 0xFD, 0x10, 0x2F, 0xFF, 0xFF, 0x70, 0x00, 0x05, 0xEF, 0xFF,
+  0xF8, 0x07, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF0, 0xAF, 0xFF, 0xF5, 0x00, 0x00,
+  0x00, 0x0C, 0xFF, 0xFF, 0x4A, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0xAF, 0xFF,
+  0xF9, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x36, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x1B, 0xFF, 0xFF,
+  0xE0, 0x1E, 0xFF, 0xFF, 0xFD, 0xAA, 0xBF, 0xFF, 0xFF, 0xF7, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x28,
+  0xEF, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x55, 0x43, 0x00, 0x00, 0x00,
+  0x00,
+  // U+0039 '9'
+  0x00, 0x00, 0x16, 0xAE, 0xFE, 0xDA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xD3, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x5F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x0D, 0xFF, 0xFF, 0xFA, 0x55, 0xAF, 0xFF, 0xFF, 0xC0, 0x05,
+  0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x40, 0x9F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xCF,
+  0xFF, 0xFA, 0x0A, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xE0, 0xBF, 0xFF, 0xF5, 0x00,
+  0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0xAF,
+  0xFF, 0xF9, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x49, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x1D, 0xFF,
+  0xFF, 0xF4, 0x4F, 0xFF, 0xFF, 0xD5, 0x12, 0x6E, 0xFF, 0xFF, 0xFF, 0x40, 0xDF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0x10, 0x04,
+  0xEF, 0xFF, 0xFF, 0xFF, 0xC1, 0xCF, 0xFF, 0xF0, 0x00, 0x01, 0x8D, 0xFF, 0xFD, 0x80, 0x0F, 0xFF,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x70, 0x00, 0x02, 0x00, 0x00, 0x04, 0xAF, 0xFF, 0xFF, 0xD0,
+  0x00, 0x00, 0xFF, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x34, 0x55, 0x54, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00,
+  // U+0041 'A'
+  0x00, 0x00, 0x00, 0x00, 0x1B, 0xBB, 0xBB, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xCF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xCF, 0xFF, 0xF4, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
+  0xFB, 0x0E, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x9F, 0xFF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF3, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0x80, 0x00, 0xAF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF4, 0x00,
+  0x05, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+  0x10, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+  0x00, 0xEF, 0xFF, 0xF5, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+  0xAA, 0xAA, 0xAA, 0xBF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x0A, 0xFF,
+  0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xD0, 0x00, 0x6F, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x6F,
+  0xFF, 0xFF, 0x40, 0x0B, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF9, 0x02,
+  0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0xFA,
+  // U+0056 'V'
+  0x9A, 0xAA, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAA, 0xAA, 0xA3, 0x9F, 0xFF, 0xFD, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x4F, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0xFF, 0xFF, 0xA0, 0x0D, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x50,
+  0x08, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF2,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0xDF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE0, 0x00,
+  0x00, 0x3F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x0D, 0xFF, 0xFF,
+  0x60, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x5F,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xAF, 0xFF, 0xF9, 0x00, 0x00,
+  0x00, 0x00, 0xDF, 0xFF, 0xF5, 0x00, 0x00, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xFA, 0x00, 0x04, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x09, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x40, 0x0E, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+  0xFF, 0xC0, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF1, 0xBF, 0xFF,
+  0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  // U+0057 'W'
+  0x9A, 0xAA, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAA,
+  0xAA, 0x7A, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0xCF, 0xFF, 0xF7, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF0, 0x0E, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF,
+  0xF1, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x00, 0xAF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xFF, 0xFF, 0x50, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x70, 0x06, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0B,
+  0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF3, 0x00, 0x2F, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xEF, 0xFF, 0xF4,
+  0x00, 0x00, 0x4F, 0xFF, 0xF5, 0xFF, 0xFF, 0x10, 0x00, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x0A, 0xFF,
+  0xFF, 0x70, 0x00, 0x08, 0xFF, 0xFD, 0x0F, 0xFF, 0xF5, 0x00, 0x00, 0xAF, 0xFF, 0xF7, 0x00, 0x00,
+  0x6F, 0xFF, 0xFB, 0x00, 0x00, 0xCF, 0xFF, 0xA0, 0xDF, 0xFF, 0x90, 0x00, 0x0E, 0xFF, 0xFF, 0x30,
+  0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF6, 0x0A, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF,
+  0xE0, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x30, 0x05, 0xFF, 0xFF, 0x30, 0x6F, 0xFF, 0xF2, 0x00, 0x5F,
+  0xFF, 0xFA, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF6, 0x00, 0x9F, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0x60,
+  0x0A, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x0C, 0xFF, 0xFA, 0x00, 0x0E, 0xFF,
+  0xFA, 0x00, 0xDF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x60, 0x00,
+  0xAF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x5F, 0xFF, 0xF2,
+  0x00, 0x05, 0xFF, 0xFF, 0x14, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x48, 0xFF,
+  0xFE, 0x00, 0x00, 0x2F, 0xFF, 0xF5, 0x7F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF7,
+  0xAF, 0xFF, 0xA0, 0x00, 0x00, 0xDF, 0xFF, 0x7A, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0xAD, 0xFF, 0xF6, 0x00, 0x00, 0x09, 0xFF, 0xFA, 0xDF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x0D, 0xFF, 0xFC, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x5F, 0xFF, 0xCF, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xF2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF,
+  0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x05, 0xFF,
+  0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+};
+
+constexpr TFT_eSPI_SmoothFont::compiledFont Readout36 = {
+  { 15, 36, 37, 9, 28, 9, 28, 9 }, // gCount, height, yAdvance, spaceWidth, ascent, descent, maxAscent, maxDescent
+  35, 910, 4, // maxAdvance, maxSize, bpp
+  Readout36_bitmap,
+  Readout36_unicode,
+  Readout36_dY,
+  Readout36_height,
+  Readout36_width,
+  Readout36_xAdvance,
+  Readout36_dX,
+  Readout36_bitmaps,
+};
@@ -0,0 +1,102 @@
+/*
+  Compares the load time and RAM use of the same smooth font stored as:
+
+    1. A vlw file in SPIFFS, the glyph records are parsed when loaded
+    2. An indexed font (vli) file in SPIFFS, the metrics are loaded with one read
+    3. An indexed font in a PROGMEM array, the metrics are used in place
+
+  The vli file and the array header were made from the vlw file with:
+    python3 Tools/Convert_Smooth_Font/vlw2vli.py NotoSansBold15.vlw
+    python3 Tools/Convert_Smooth_Font/vlw2vli.py NotoSansBold15.vlw NotoSansBold15_vli.h
+
+  Each font is unloaded and loaded again LOADS times. Results are printed to
+  the Serial Monitor and shown on the TFT in each font.
+*/
+//  The fonts used are in the sketch data folder, press Ctrl+K to view.
+
+//  Upload the fonts to SPIFFS using the "Tools"  "ESP8266 (or ESP32) Sketch Data Upload"
+//  menu option in the IDE.
+
+#define VLW_FONT "/NotoSansBold15.vlw"
+#define VLI_FONT "/NotoSansBold15.vli"
+
+#define LOADS 20
+
+#include "NotoSansBold15_vli.h"
+
+// Font files are stored in SPIFFS, so load the library
+#include <FS.h>
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI tft = TFT_eSPI();
+
+TFT_eSPI_SmoothFont arrayFont(NotoSansBold15_vli);
+
+uint32_t freeHeap(void)
+{
+#if defined (ESP8266) || defined (ESP32)
+  return ESP.getFreeHeap();
+#else
+  return 0;
+#endif
+}
+
+void setup(void) {
+
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+
+  if (!SPIFFS.begin()) {
+    Serial.println("SPIFFS initialisation failed!");
+    while (1) yield(); // Stay here twiddling thumbs waiting
+  }
+}
+
+// Reload a font LOADS times and report the average time and the RAM used
+void benchmark(const char *name, TFT_eSPI_SmoothFont * font, int32_t y)
+{
+  uint32_t total = 0;
+  uint32_t heap  = 0;
+
+  for (uint16_t i = 0; i < LOADS; i++) {
+    font->unloadFont();
+    heap = freeHeap();
+    uint32_t t = micros();
+    font->loadFont();
+    total += micros() - t;
+    heap -= freeHeap();
+    yield();
+  }
+
+  if (!font->loaded()) {
+    Serial.printf("%s did not load, did you upload the fonts?\r\n", name);
+    return;
+  }
+
+  Serial.printf("%-12s %6lu us load (%5lu us metrics), %5u bytes font RAM, %5u bytes heap\r\n",
+                name, (unsigned long)(total / LOADS), (unsigned long)font->loadDuration(),
+                (unsigned)font->metricsSize(), (unsigned)heap);
+
+  char line[64];
+  snprintf(line, sizeof(line), "%s %lu us %u bytes", name, (unsigned long)(total / LOADS), (unsigned)font->metricsSize());
+  tft.setFont(font);
+  tft.drawString(line, 10, y);
+}
+
+void loop() {
+
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setTextDatum(TL_DATUM);
+
+  Serial.println();
+  benchmark("vlw file",  TFT_eSPI_SmoothFont::require(VLW_FONT), 10);
+  benchmark("vli file",  TFT_eSPI_SmoothFont::require(VLI_FONT), 40);
+  benchmark("vli array", &arrayFont, 70);
+
+  delay(5000);
+}
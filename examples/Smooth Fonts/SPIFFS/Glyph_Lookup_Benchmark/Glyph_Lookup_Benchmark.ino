@@ -0,0 +1,103 @@
+/*
+  Compares the glyph lookup speed of the smooth font index against the old
+  linear search of the font gUnicode[] table.
+
+  Every Unicode point in the font is looked up, plus a missing code, so the
+  result depends on the number of glyphs. Large CJK fonts (thousands of
+  glyphs) show the biggest improvement.
+
+  Results are printed to the Serial Monitor and shown on the TFT.
+*/
+//  The font used is in the sketch data folder, press Ctrl+K to view.
+
+//  Upload the font to SPIFFS using the "Tools"  "ESP8266 (or ESP32) Sketch Data Upload"
+//  menu option in the IDE.
+
+#define AA_FONT "/Latin-Hiragana-24.vlw"
+
+// Font files are stored in SPIFFS, so load the library
+#include <FS.h>
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI tft = TFT_eSPI();
+
+#define PASSES 20
+
+// The search used before the lookup index was added
+bool linearIndex(TFT_eSPI_SmoothFont * font, uint16_t unicode, uint16_t *index)
+{
+  for (uint16_t i = 0; i < font->gFont.gCount; i++)
+  {
+    if (font->gUnicode[i] == unicode)
+    {
+      *index = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+void setup(void) {
+
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+
+  if (!SPIFFS.begin()) {
+    Serial.println("SPIFFS initialisation failed!");
+    while (1) yield(); // Stay here twiddling thumbs waiting
+  }
+}
+
+void loop() {
+
+  TFT_eSPI_SmoothFont * font = TFT_eSPI_SmoothFont::require(AA_FONT);
+  if (!font->loaded()) {
+    Serial.println("\r\nFont missing in SPIFFS, did you upload it?");
+    while (1) yield();
+  }
+
+  uint16_t count = font->gFont.gCount;
+  uint32_t lookups = (uint32_t)PASSES * (count + 1);
+  uint32_t found = 0;
+  uint16_t index;
+
+  uint32_t t = micros();
+  for (uint16_t p = 0; p < PASSES; p++) {
+    for (uint16_t i = 0; i < count; i++) found += linearIndex(font, font->gUnicode[i], &index);
+    found += linearIndex(font, 0xFFFE, &index); // Not in font, worst case
+    yield();
+  }
+  uint32_t linearTime = micros() - t;
+
+  t = micros();
+  for (uint16_t p = 0; p < PASSES; p++) {
+    for (uint16_t i = 0; i < count; i++) found += font->getUnicodeIndex(font->gUnicode[i], &index);
+    found += font->getUnicodeIndex(0xFFFE, &index);
+    yield();
+  }
+  uint32_t indexTime = micros() - t;
+
+  float linearRate = lookups * 1000000.0 / (linearTime ? linearTime : 1);
+  float indexRate  = lookups * 1000000.0 / (indexTime  ? indexTime  : 1);
+
+  Serial.printf("\r\n%u glyphs, %u lookups (%u found)\r\n", count, lookups, found);
+  Serial.printf("Linear search : %10.0f lookups/s\r\n", linearRate);
+  Serial.printf("Indexed lookup: %10.0f lookups/s\r\n", indexRate);
+  Serial.printf("Speed up      : %10.1f x\r\n", indexRate / linearRate);
+
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.setTextDatum(TL_DATUM);
+  tft.drawString("Glyphs in font", 10, 10, 2);
+  tft.drawNumber(count, 200, 10, 2);
+  tft.drawString("Linear lookups/s", 10, 30, 2);
+  tft.drawNumber((long)linearRate, 200, 30, 2);
+  tft.drawString("Indexed lookups/s", 10, 50, 2);
+  tft.drawNumber((long)indexRate, 200, 50, 2);
+
+  delay(5000);
+}
@@ -0,0 +1,108 @@
+/*
+  Measures smooth font rendering speed with and without the alpha blend tables.
+
+  A paragraph is drawn PASSES times in several colour pairs, first blending
+  each anti-aliased edge pixel with alphaBlend() and then using the blend
+  table cached for each colour pair. The rendering rate is reported in
+  character cell pixels per second on the Serial Monitor and on the TFT.
+
+  The table size and number of tables kept are set by SMOOTH_BLEND_LEVELS
+  and SMOOTH_BLEND_TABLES, see TFT_eSPI.h
+*/
+//  The font used is in the sketch data folder, press Ctrl+K to view.
+
+//  Upload the font to SPIFFS using the "Tools"  "ESP8266 (or ESP32) Sketch Data Upload"
+//  menu option in the IDE.
+
+#define AA_FONT "/NotoSansBold15.vlw"
+
+#define PASSES 5
+
+// Font files are stored in SPIFFS, so load the library
+#include <FS.h>
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI tft = TFT_eSPI();
+
+const char* paragraph[] = {
+  "Smooth fonts are anti-aliased, so every",
+  "glyph edge pixel is a blend of the text",
+  "and background colours. The blend table",
+  "holds the result for every alpha level,",
+  "so each edge pixel is one table lookup",
+  "instead of three multiplies per channel.",
+};
+
+const uint16_t colours[][2] = {
+  { TFT_WHITE,  TFT_BLACK },
+  { TFT_YELLOW, TFT_NAVY },
+  { TFT_BLACK,  TFT_ORANGE },
+};
+
+void setup(void) {
+
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+
+  if (!SPIFFS.begin()) {
+    Serial.println("SPIFFS initialisation failed!");
+    while (1) yield(); // Stay here twiddling thumbs waiting
+  }
+}
+
+// Draw the paragraph PASSES times in each colour pair, return cell pixels per second
+uint32_t renderRate(void)
+{
+  uint32_t pixels = 0;
+  uint32_t t = micros();
+
+  for (uint16_t p = 0; p < PASSES; p++) {
+    for (uint8_t c = 0; c < sizeof(colours) / sizeof(colours[0]); c++) {
+      tft.setTextColor(colours[c][0], colours[c][1]);
+      for (uint8_t line = 0; line < sizeof(paragraph) / sizeof(paragraph[0]); line++) {
+        tft.drawString(paragraph[line], 5, 5 + line * tft.fontHeight());
+        pixels += tft.textWidth(paragraph[line]) * tft.fontHeight();
+      }
+      yield();
+    }
+  }
+
+  t = micros() - t;
+  return (uint64_t)pixels * 1000000 / (t ? t : 1);
+}
+
+void loop() {
+
+  TFT_eSPI_SmoothFont * font = TFT_eSPI_SmoothFont::require(AA_FONT);
+  if (!font->loaded()) {
+    Serial.println("\r\nFont missing in SPIFFS, did you upload it?");
+    while (1) yield();
+  }
+
+  tft.fillScreen(TFT_BLACK);
+  tft.setFont(font);
+  tft.setTextDatum(TL_DATUM);
+
+  tft.setAttribute(BLEND_TABLES, false);
+  uint32_t blendRate = renderRate();
+
+  tft.setAttribute(BLEND_TABLES, true);
+  uint32_t tableRate = renderRate();
+
+  Serial.printf("\r\nalphaBlend() : %8u pixels/s\r\n", blendRate);
+  Serial.printf("Blend tables : %8u pixels/s\r\n", tableRate);
+  Serial.printf("Speed up     : %8.2f x\r\n", (float)tableRate / (blendRate ? blendRate : 1));
+
+  char line[48];
+  tft.setTextColor(TFT_GREEN, TFT_BLACK);
+  snprintf(line, sizeof(line), "alphaBlend(): %u pixels/s", blendRate);
+  tft.drawString(line, 5, 150);
+  snprintf(line, sizeof(line), "Blend tables: %u pixels/s", tableRate);
+  tft.drawString(line, 5, 170);
+
+  delay(5000);
+}
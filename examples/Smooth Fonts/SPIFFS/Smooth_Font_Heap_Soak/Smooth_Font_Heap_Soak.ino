@@ -0,0 +1,130 @@
+/*
+  Heap fragmentation soak test for smooth font rendering.
+
+  Text is redrawn continuously for SOAK_MINUTES while the sketch also makes
+  short lived allocations of random sizes, like a typical application. Every
+  few seconds the free heap, the largest free block and the glyph rate are
+  reported to the Serial Monitor.
+
+  drawGlyph() renders using scratch space reserved when the font is loaded so
+  the free heap and the largest free block should stay flat for the whole run.
+  If the largest block shrinks over time then something is fragmenting the heap.
+*/
+//  The font used is in the sketch data folder, press Ctrl+K to view.
+
+//  Upload the font to SPIFFS using the "Tools"  "ESP8266 (or ESP32) Sketch Data Upload"
+//  menu option in the IDE.
+
+#define AA_FONT "/NotoSansBold36.vlw"
+
+#define SOAK_MINUTES 10   // Length of the test
+#define REPORT_MS    5000 // Time between reports
+
+// Font files are stored in SPIFFS, so load the library
+#include <FS.h>
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI tft = TFT_eSPI();
+
+TFT_eSPI_SmoothFont * aaFont = nullptr;
+
+uint32_t startTime  = 0;
+uint32_t reportTime = 0;
+uint32_t glyphs     = 0;
+uint32_t minHeap    = 0xFFFFFFFF;
+uint32_t minBlock   = 0xFFFFFFFF;
+
+void* churn[8] = { nullptr }; // Application allocations that come and go
+
+uint32_t freeHeap(void)
+{
+#if defined (ESP8266) || defined (ESP32)
+  return ESP.getFreeHeap();
+#else
+  return 0;
+#endif
+}
+
+uint32_t largestBlock(void)
+{
+#if defined (ESP8266)
+  return ESP.getMaxFreeBlockSize();
+#elif defined (ESP32)
+  return ESP.getMaxAllocHeap();
+#else
+  return 0;
+#endif
+}
+
+void setup(void) {
+
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+
+  if (!SPIFFS.begin()) {
+    Serial.println("SPIFFS initialisation failed!");
+    while (1) yield(); // Stay here twiddling thumbs waiting
+  }
+
+  aaFont = TFT_eSPI_SmoothFont::require(AA_FONT);
+  if (!aaFont->loaded()) {
+    Serial.println("\r\nFont missing in SPIFFS, did you upload it?");
+    while (1) yield();
+  }
+
+  tft.fillScreen(TFT_BLACK);
+  tft.setFont(aaFont);
+  tft.setTextDatum(MC_DATUM);
+
+  Serial.printf("\r\nFont RAM %u bytes, loaded in %lu us, start heap %u, largest block %u\r\n",
+                (unsigned)aaFont->metricsSize(), (unsigned long)aaFont->loadDuration(),
+                (unsigned)freeHeap(), (unsigned)largestBlock());
+
+  startTime = reportTime = millis();
+}
+
+void loop() {
+
+  // Redraw a changing value and a fixed label, as a dashboard would
+  char value[16];
+  snprintf(value, sizeof(value), "%ld.%02ld V", random(0, 100), random(0, 100));
+
+  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
+  tft.setTextPadding(tft.width());
+  tft.drawString(value, tft.width() / 2, tft.height() / 3);
+
+  tft.setTextColor(TFT_WHITE, TFT_BLUE);
+  tft.setTextPadding(0);
+  tft.drawString("Voltage", tft.width() / 2, 2 * tft.height() / 3);
+
+  glyphs += strlen(value) + 7;
+
+  // Application heap churn
+  uint8_t slot = random(0, 8);
+  if (churn[slot]) free(churn[slot]);
+  churn[slot] = malloc(random(16, 512));
+
+  uint32_t heap  = freeHeap();
+  uint32_t block = largestBlock();
+  if (heap  < minHeap)  minHeap  = heap;
+  if (block < minBlock) minBlock = block;
+
+  if (millis() - reportTime >= REPORT_MS) {
+    uint32_t elapsed = millis() - startTime;
+    Serial.printf("%6lu s: heap %u (min %u), largest block %u (min %u), %lu glyphs/s\r\n",
+                  (unsigned long)(elapsed / 1000), (unsigned)heap, (unsigned)minHeap, (unsigned)block,
+                  (unsigned)minBlock, (unsigned long)(glyphs * 1000UL / (millis() - reportTime)));
+    glyphs = 0;
+    reportTime = millis();
+
+    if (elapsed > SOAK_MINUTES * 60000UL) {
+      Serial.println("Soak test complete");
+      while (1) yield();
+    }
+  }
+  yield();
+}
@@ -0,0 +1,82 @@
+/*
+  Shows a paragraph laid out in a box with layoutText() and drawn with drawLayout().
+
+  The paragraph is decoded once and broken into lines between words to fit
+  the box width. The layout is then used to measure the text, to centre the
+  box on the screen and to redraw it each time the counter below changes.
+  Calling layoutText() again with the same text, font and width does nothing.
+
+  The time taken to lay out and to draw the paragraph is printed to the
+  Serial Monitor.
+*/
+//  The font used is in the sketch data folder, press Ctrl+K to view.
+
+//  Upload the font to SPIFFS using the "Tools"  "ESP8266 (or ESP32) Sketch Data Upload"
+//  menu option in the IDE.
+
+#define AA_FONT "/NotoSansBold15.vlw"
+
+#define BOX_WIDTH 200
+
+// Font files are stored in SPIFFS, so load the library
+#include <FS.h>
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI tft = TFT_eSPI();
+
+TFT_eSPI_TextLayout paragraph;
+
+const char* text = "Smooth font text can be laid out in a box. The lines are broken "
+                   "between words so that each line fits the width of the box.\n"
+                   "A new line character starts a new line, and a word too long "
+                   "for the box is broken where it reaches the edge.";
+
+uint32_t count = 0;
+
+void setup(void) {
+
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+
+  if (!SPIFFS.begin()) {
+    Serial.println("SPIFFS initialisation failed!");
+    while (1) yield(); // Stay here twiddling thumbs waiting
+  }
+
+  tft.fillScreen(TFT_BLACK);
+  tft.setFont(TFT_eSPI_SmoothFont::require(AA_FONT));
+}
+
+void loop() {
+
+  tft.setTextColor(TFT_WHITE, TFT_NAVY);
+
+  // Only the first call decodes the text, after that the layout is reused
+  uint32_t t = micros();
+  tft.layoutText(paragraph, text, BOX_WIDTH);
+  uint32_t layoutTime = micros() - t;
+
+  // Centre the laid out text on the screen
+  int32_t x = (tft.width()  - paragraph.width())  / 2;
+  int32_t y = (tft.height() - paragraph.height()) / 2;
+
+  t = micros();
+  tft.drawLayout(paragraph, x, y);
+  uint32_t drawTime = micros() - t;
+
+  Serial.printf("%u lines, %d x %d pixels, layout %lu us, draw %lu us\r\n",
+                paragraph.lines(), paragraph.width(), paragraph.height(),
+                (unsigned long)layoutTime, (unsigned long)drawTime);
+
+  tft.setTextColor(TFT_YELLOW, TFT_BLACK);
+  tft.setCursor(x, y + paragraph.height() + 10);
+  tft.print("Redrawn ");
+  tft.print(++count);
+  tft.print(" times ");
+
+  delay(1000);
+}
@@ -0,0 +1,77 @@
+/*
+  Draws a full screen animation without flicker using a Sprite only 32 lines
+  high, as a full screen Sprite needs more RAM than many boards have (300
+  Kbytes for 480 x 320 at 16 bits per pixel).
+
+  Each frame is recorded in a display list, then the library draws it a band
+  at a time: the part of each recorded shape in the band is drawn into the
+  band Sprite, and the pixels drawn are pushed to the screen. Nothing is ever
+  drawn over on the screen so there is no flicker.
+
+  Only fills, lines, circles and the other shapes drawn with them, and text
+  without a background colour, are recorded. The display list grows to hold
+  the whole frame, so start it big enough to avoid that, the number of
+  commands recorded is printed to the Serial Monitor with the frame time.
+*/
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI    tft  = TFT_eSPI();
+TFT_eSprite band = TFT_eSprite(&tft);
+
+#define BAND_HEIGHT 32      // Lines in the band, RAM used is width x height x 2 bytes
+#define LIST_BYTES  16000   // Display list RAM, 10 bytes per command
+
+void drawFrame(uint16_t frame)
+{
+  int16_t w = tft.width(), h = tft.height();
+
+  // Background grid
+  tft.fillRect(0, 0, w, h, TFT_NAVY);
+  for (int16_t x = 0; x < w; x += 40) tft.drawFastVLine(x, 0, h, TFT_DARKGREY);
+  for (int16_t y = 0; y < h; y += 40) tft.drawFastHLine(0, y, w, TFT_DARKGREY);
+
+  // Balls moving across the grid
+  for (uint8_t i = 0; i < 8; i++) {
+    int16_t x = (frame * (i + 2) + i * 57) % (2 * w);
+    int16_t y = (frame * (9 - i) + i * 31) % (2 * h);
+    if (x >= w) x = 2 * w - 1 - x;
+    if (y >= h) y = 2 * h - 1 - y;
+    tft.fillCircle(x, y, 12 + i * 2, TFT_RED + i * 0x0841);
+  }
+
+  // A rotating needle and the frame count
+  float a = frame * 0.05;
+  tft.drawLine(w / 2, h / 2, w / 2 + 100 * cos(a), h / 2 + 100 * sin(a), TFT_YELLOW);
+  tft.setTextColor(TFT_WHITE);
+  tft.drawNumber(frame, 10, 10, 4);
+}
+
+void setup(void)
+{
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+
+  band.createSprite(tft.width(), BAND_HEIGHT);
+  tft.setDisplayListBand(&band);
+}
+
+void loop()
+{
+  static uint16_t frame = 0;
+
+  uint32_t recorded = tft.dlStats.recorded;
+  uint32_t t = millis();
+
+  tft.startDisplayList(LIST_BYTES);
+  drawFrame(frame++);
+  tft.endDisplayList();
+
+  if ((frame % 50) == 0) {
+    Serial.printf("Frame %lu ms, %lu commands recorded\r\n", millis() - t,
+                  (unsigned long)(tft.dlStats.recorded - recorded));
+  }
+}
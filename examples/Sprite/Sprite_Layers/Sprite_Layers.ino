@@ -0,0 +1,88 @@
+/*
+  Moves a ball over a panel with a label on top, three Sprites of different
+  colour depths, without flicker.
+
+  Pushing each Sprite in turn with a transparent colour sends the pixels
+  where they overlap more than once, and the panel is seen without the ball
+  for a moment. pushLayers() merges the Sprites one screen line at a time in
+  a line buffer and sends each line once, so no screen size buffer is needed.
+
+  The time to draw each frame is printed to the Serial Monitor.
+*/
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI    tft   = TFT_eSPI();
+TFT_eSprite panel = TFT_eSprite(&tft);  // 8 bpp background panel
+TFT_eSprite ball  = TFT_eSprite(&tft);  // 16 bpp ball, black is transparent
+TFT_eSprite label = TFT_eSprite(&tft);  // 1 bpp text, 0 bits are transparent
+
+#define PANEL_W 200
+#define PANEL_H 120
+#define BALL_R   16
+
+// Colours of the 0 and 1 bits of the label
+const uint16_t labelColors[2] = { TFT_BLACK, TFT_YELLOW };
+
+TFT_eSPI::spriteLayer layers[3] = {
+  { &panel, 0, 0, LAYER_OPAQUE, NULL },
+  { &ball,  0, 0, TFT_BLACK,    NULL },
+  { &label, 0, 0, 0,            labelColors }
+};
+
+int16_t panelX, panelY;
+int16_t ballX = 20, ballY = 10, ballDX = 2, ballDY = 1;
+
+void setup(void)
+{
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+
+  panelX = (tft.width()  - PANEL_W) / 2;
+  panelY = (tft.height() - PANEL_H) / 2;
+
+  panel.setColorDepth(8);
+  panel.createSprite(PANEL_W, PANEL_H);
+  panel.fillSprite(TFT_NAVY);
+  for (int16_t x = 0; x < PANEL_W; x += 20) panel.drawFastVLine(x, 0, PANEL_H, TFT_DARKGREY);
+  for (int16_t y = 0; y < PANEL_H; y += 20) panel.drawFastHLine(0, y, PANEL_W, TFT_DARKGREY);
+
+  ball.setColorDepth(16);
+  ball.createSprite(2 * BALL_R + 1, 2 * BALL_R + 1);
+  ball.fillSprite(TFT_BLACK);
+  ball.fillCircle(BALL_R, BALL_R, BALL_R, TFT_RED);
+  ball.fillCircle(BALL_R - 5, BALL_R - 5, 4, TFT_WHITE);
+
+  label.setColorDepth(1);
+  label.createSprite(PANEL_W, 20);
+  label.setTextColor(1);
+  label.setTextDatum(MC_DATUM);
+  label.drawString("Sprite layers", PANEL_W / 2, 10, 2);
+
+  layers[0].x = panelX;
+  layers[0].y = panelY;
+  layers[2].x = panelX;
+  layers[2].y = panelY + PANEL_H - 30;
+}
+
+void loop()
+{
+  ballX += ballDX;
+  ballY += ballDY;
+  if ((ballX <= 0) || (ballX >= PANEL_W - 2 * BALL_R - 1)) ballDX = -ballDX;
+  if ((ballY <= 0) || (ballY >= PANEL_H - 2 * BALL_R - 1)) ballDY = -ballDY;
+
+  layers[1].x = panelX + ballX;
+  layers[1].y = panelY + ballY;
+
+  uint32_t t = micros();
+  tft.pushLayers(panelX, panelY, PANEL_W, PANEL_H, layers, 3);
+  t = micros() - t;
+
+  static uint16_t frame = 0;
+  if ((++frame % 100) == 0) Serial.printf("Frame %lu us\r\n", (unsigned long)t);
+}
@@ -0,0 +1,60 @@
+/*
+  Creates and deletes Sprites of random sizes for popups, as a user interface
+  might, with the Sprite memory taken from a Sprite memory pool.
+
+  The pool is reserved once in setup(). Sprites that use it are created after
+  setAttribute(SPRITE_POOL, true), and their memory comes from the pool instead
+  of the heap, so the heap does not become fragmented however long the sketch
+  runs. A Sprite that does not fit in the pool uses the heap and is counted as
+  a fail.
+
+  The pool statistics are printed to the Serial Monitor.
+*/
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI    tft   = TFT_eSPI();
+TFT_eSprite popup = TFT_eSprite(&tft);
+
+#define POOL_BYTES 65536    // A power of 2 so the whole pool can hold one Sprite
+
+void setup(void)
+{
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+  tft.fillScreen(TFT_BLACK);
+
+  if (!TFT_eSprite::createSpritePool(POOL_BYTES)) Serial.println("No RAM for the Sprite pool");
+
+  popup.setColorDepth(16);
+  popup.setAttribute(SPRITE_POOL, true);
+}
+
+void loop()
+{
+  for (uint16_t i = 0; i < 100; i++) {
+    int16_t w = random(40, 160);
+    int16_t h = random(20, 100);
+
+    if (popup.createSprite(w, h)) {
+      popup.fillSprite(random(0x10000));
+      popup.drawRect(0, 0, w, h, TFT_WHITE);
+      popup.setTextColor(TFT_WHITE);
+      popup.drawString("Popup", 4, 4, 2);
+      popup.pushSprite(random(tft.width() - w), random(tft.height() - h));
+      popup.deleteSprite();
+    }
+  }
+
+  TFT_eSprite::spritePoolStats stats = TFT_eSprite::getSpritePoolStats();
+
+  Serial.printf("Pool %lu bytes, used %lu, high-water %lu, largest free %lu, fragmentation %u%%\r\n",
+                (unsigned long)stats.size, (unsigned long)stats.used, (unsigned long)stats.highWater,
+                (unsigned long)stats.largestFree, stats.fragmentation);
+  Serial.printf("Sprites from the pool %lu, did not fit %lu\r\n", (unsigned long)stats.allocs, (unsigned long)stats.fails);
+
+  delay(1000);
+}
@@ -0,0 +1,81 @@
+/*
+  Times scroll() of 1 and 4 bit per pixel Sprites against moving the pixels
+  one at a time with readPixelValue() and drawPixel(), as scroll() used to.
+
+  scroll() now moves each line of the scroll zone as a run of bits. When the
+  pixels move by whole bytes (no x movement, an even x movement at 4 bpp, or
+  a multiple of 8 at 1 bpp) the lines are moved with memmove(), otherwise the
+  bytes are shifted into place.
+
+  The times for 100 scrolls are printed to the Serial Monitor.
+*/
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI    tft = TFT_eSPI();
+TFT_eSprite spr = TFT_eSprite(&tft);
+
+#define SPR_W 296           // Size of a 2.9" ePaper screen
+#define SPR_H 128
+#define COUNT 100           // Scrolls timed
+
+// Scroll the whole Sprite one pixel at a time, gaps are left as they are
+void pixelScroll(int16_t dx, int16_t dy)
+{
+  int32_t w = SPR_W - abs(dx), h = SPR_H - abs(dy);
+
+  for (int32_t i = 0; i < h; i++) {
+    int32_t ty = (dy > 0) ? SPR_H - 1 - i : i;
+    for (int32_t j = 0; j < w; j++) {
+      int32_t tx = (dx > 0) ? SPR_W - 1 - j : j;
+      spr.drawPixel(tx, ty, spr.readPixelValue(tx - dx, ty - dy));
+    }
+  }
+}
+
+void timeScroll(int16_t dx, int16_t dy)
+{
+  uint32_t t = micros();
+  for (uint16_t i = 0; i < COUNT; i++) pixelScroll(dx, dy);
+  uint32_t pixelTime = micros() - t;
+
+  t = micros();
+  for (uint16_t i = 0; i < COUNT; i++) spr.scroll(dx, dy);
+  uint32_t scrollTime = micros() - t;
+
+  Serial.printf("%3d bpp  dx %3d  dy %3d  %10lu %10lu\r\n", spr.getColorDepth(), dx, dy,
+                (unsigned long)pixelTime, (unsigned long)scrollTime);
+}
+
+void setup(void)
+{
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+}
+
+void loop()
+{
+  Serial.printf("%-23s %10s %10s\r\n", "Scroll", "Pixels us", "scroll us");
+
+  for (uint8_t depth = 1; depth <= 4; depth += 3) {
+    spr.setColorDepth(depth);
+    spr.createSprite(SPR_W, SPR_H);
+    if (depth == 4) spr.createPalette(default_4bit_palette);
+
+    for (int16_t y = 0; y < SPR_H; y += 8) spr.drawString("Scroll benchmark", 0, y, 1);
+    spr.setScrollRect(0, 0, SPR_W, SPR_H, TFT_BLACK);
+
+    timeScroll(0, -1);
+    timeScroll(-1, 0);
+    timeScroll(-2, -1);
+    timeScroll(8, 1);
+
+    spr.deleteSprite();
+  }
+
+  Serial.println();
+  delay(5000);
+}
@@ -0,0 +1,80 @@
+/*
+  Checks that a scene drawn through a display list band matches the same
+  scene drawn directly.
+
+  The scene mixes fills, which are recorded in the display list, with text
+  drawn with a background colour and pushImage(), which are not recorded and
+  so flush the list part way through. The screen is read back after each
+  drawing and a checksum of each line compared, so the TFT must be readable
+  (TFT_MISO connected). The result is printed to the Serial Monitor.
+*/
+
+#include <SPI.h>
+#include <TFT_eSPI.h>       // Hardware-specific library
+
+TFT_eSPI    tft  = TFT_eSPI();
+TFT_eSprite band = TFT_eSprite(&tft);
+
+uint16_t  image[32 * 16];
+uint32_t* sums;
+uint16_t* line;
+
+void drawScene(void)
+{
+  tft.fillScreen(TFT_DARKGREY);
+  tft.fillRect(10, 10, 200, 100, TFT_BLUE);
+  tft.setTextColor(TFT_WHITE, TFT_BLUE);
+  tft.drawString("Label", 20, 20, 2);
+  tft.fillRect(0, 0, 4, 4, TFT_RED);
+  tft.pushImage(60, 60, 32, 16, image);
+  tft.fillRect(tft.width() - 4, tft.height() - 4, 4, 4, TFT_RED);
+  tft.fillCircle(100, 60, 30, TFT_GREEN);
+  tft.drawLine(0, 0, tft.width() - 1, tft.height() - 1, TFT_YELLOW);
+}
+
+// Checksum each line of the screen, return the number that differ from the last time
+uint16_t checkScreen(bool store)
+{
+  uint16_t differ = 0;
+
+  for (int16_t y = 0; y < tft.height(); y++) {
+    tft.readRect(0, y, tft.width(), 1, line);
+    uint32_t sum = 0;
+    for (int16_t x = 0; x < tft.width(); x++) sum = sum * 31 + line[x];
+    if (!store && (sum != sums[y])) differ++;
+    sums[y] = sum;
+  }
+
+  return differ;
+}
+
+void setup(void)
+{
+  Serial.begin(250000);
+
+  tft.begin();
+  tft.setRotation(1);
+
+  for (uint16_t i = 0; i < 32 * 16; i++) image[i] = i * 73;
+
+  sums = (uint32_t*)malloc(tft.height() * sizeof(uint32_t));
+  line = (uint16_t*)malloc(tft.width() * sizeof(uint16_t));
+
+  band.createSprite(tft.width(), 32);
+}
+
+void loop()
+{
+  drawScene();
+  checkScreen(true);
+
+  tft.setDisplayListBand(&band);
+  tft.startDisplayList();
+  drawScene();
+  tft.endDisplayList();
+  tft.setDisplayListBand(NULL);
+
+  Serial.printf("Band: %u lines differ, %u flushes\r\n", checkScreen(false), (unsigned)tft.dlStats.flushes);
+
+  delay(2000);
+}